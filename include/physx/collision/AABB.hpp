@@ -0,0 +1,68 @@
+/**
+ * @file AABB.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_AABB_HPP
+#define PHYSX_AABB_HPP
+
+#include <algorithm>
+#include <limits>
+
+#include "../math/MathConstants.hpp"
+
+namespace physx::collision {
+    /**
+     * @brief An axis-aligned bounding box.
+     *
+     * A box whose minimum is greater than its maximum is empty, and is used for bodies that have no bounds.
+     */
+    struct AABB {
+        math::f32 minX;
+        math::f32 minY;
+        math::f32 maxX;
+        math::f32 maxY;
+
+        /**
+         * @brief Gets a box that contains nothing and overlaps nothing.
+         * @return The empty box.
+         */
+        static AABB empty() {
+            constexpr math::f32 infinity{std::numeric_limits<math::f32>::infinity()};
+            return {infinity, infinity, -infinity, -infinity};
+        }
+
+        bool isEmpty() const {
+            return minX > maxX;
+        }
+
+        bool overlaps(const AABB& other) const {
+            return minX <= other.maxX && other.minX <= maxX && minY <= other.maxY && other.minY <= maxY;
+        }
+
+        bool contains(const AABB& other) const {
+            return minX <= other.minX && minY <= other.minY && other.maxX <= maxX && other.maxY <= maxY;
+        }
+
+        AABB merged(const AABB& other) const {
+            return {std::min(minX, other.minX), std::min(minY, other.minY),
+                    std::max(maxX, other.maxX), std::max(maxY, other.maxY)};
+        }
+
+        AABB expanded(math::f32 margin) const {
+            return {minX - margin, minY - margin, maxX + margin, maxY + margin};
+        }
+
+        /**
+         * @brief Gets the perimeter of the box, the 2D equivalent of the surface area heuristic.
+         * @return The perimeter.
+         */
+        math::f32 perimeter() const {
+            return 2.f * ((maxX - minX) + (maxY - minY));
+        }
+    };
+} // namespace physx::collision
+
+#endif //PHYSX_AABB_HPP
@@ -0,0 +1,24 @@
+/**
+ * @file BroadphaseType.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_BROADPHASETYPE_HPP
+#define PHYSX_BROADPHASETYPE_HPP
+
+#include <cstdint>
+
+namespace physx::collision {
+    /**
+     * @brief An enumeration of the broadphases a @c Simulation can find candidate pairs with.
+     */
+    enum class BroadphaseType : std::uint8_t {
+        UniformGrid,    ///< @c UniformGrid, best when bodies are of a similar size.
+        AABBTree,       ///< @c DynamicAABBTree, best when body sizes vary a lot.
+        SweepAndPrune   ///< @c SweepAndPrune, best when bodies barely move between steps.
+    };
+} // namespace physx::collision
+
+#endif //PHYSX_BROADPHASETYPE_HPP
@@ -0,0 +1,41 @@
+/**
+ * @file Contact.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_CONTACT_HPP
+#define PHYSX_CONTACT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../math/MathConstants.hpp"
+
+namespace physx::collision {
+    constexpr std::size_t maxContactPoints{2};  ///< Points in a box face contact, the most any shape pair produces.
+
+    /**
+     * @brief Two touching bodies, as found by the narrowphase and consumed by the solver.
+     *
+     * Impulses are in mass times distance per step. They start from the values cached for the pair last step, see
+     * @c ContactCache.
+     */
+    struct Contact {
+        std::uint32_t a;            ///< Index of the first body.
+        std::uint32_t b;            ///< Index of the second body.
+        math::f32 normalX;          ///< Unit normal pointing from @c a to @c b.
+        math::f32 normalY;
+        math::f32 depth;            ///< Overlap along the normal.
+        std::uint32_t pointCount;   ///< Valid entries of @c pointX and @c pointY, at least one.
+        math::f32 pointX[maxContactPoints];
+        math::f32 pointY[maxContactPoints];
+        math::f32 normalImpulse;    ///< Impulse applied along the normal so far, never negative.
+        math::f32 tangentImpulse;   ///< Friction impulse applied along (-normalY, normalX) so far.
+        math::f32 targetSpeed;      ///< Separating speed the solver aims for, from restitution or Baumgarte.
+        math::f32 depthBase;        ///< @c depth plus the gap between the centers along the normal when solving began.
+    };
+} // namespace physx::collision
+
+#endif //PHYSX_CONTACT_HPP
@@ -0,0 +1,65 @@
+/**
+ * @file ContactCache.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_CONTACTCACHE_HPP
+#define PHYSX_CONTACTCACHE_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "Contact.hpp"
+
+namespace physx::collision {
+    /**
+     * @brief @c ContactCache class.
+     *
+     * Keeps the impulses the solver accumulated on each touching pair of bodies from one step to the next, keyed by
+     * the pair. A resting stack pushes back with nearly the same impulses every step, so starting the solver from
+     * last step's values leaves it only the small change to find.
+     *
+     * Entries live in an open addressing hash table that is rebuilt from the contacts of every step, so pairs that
+     * stopped touching are dropped and both the rebuild and the lookups are linear in the contact count. A cached
+     * impulse is only reused while the contact normal still points roughly the same way. Removing a body only marks
+     * its index, and the pairs holding it are skipped until the next rebuild drops them.
+     * @namespace @c physx::collision
+     */
+    class ContactCache {
+    public:
+        ContactCache() = default;
+        ~ContactCache() = default;
+
+        void warmStart(std::vector<Contact>& contacts) const;
+        void store(const std::vector<Contact>& contacts);
+        void removeBody(std::uint32_t body);
+        void clear();
+        std::size_t size() const;
+
+        static std::uint64_t getKey(std::uint32_t a, std::uint32_t b);
+
+    private:
+        static constexpr math::f32 minNormalAlignment{0.95f};  ///< Cosine of the largest normal turn still reused.
+        static constexpr std::uint64_t emptyKey{~std::uint64_t{0}};   ///< Never a pair, both indices would match
+
+        struct Entry {
+            std::uint64_t key;
+            math::f32 normalX;          ///< Normal pointing from the lower to the higher body index.
+            math::f32 normalY;
+            math::f32 normalImpulse;
+            math::f32 tangentImpulse;
+        };
+
+        std::vector<Entry> slots;       ///< Power of two sized, at most half full
+        std::size_t count{0};
+        std::vector<std::uint32_t> removedBodies;   ///< Sorted indices removed since the last rebuild
+
+        bool isRemoved(std::uint64_t key) const;
+
+        std::size_t findSlot(std::uint64_t key) const;
+    };
+} // namespace physx::collision
+
+#endif //PHYSX_CONTACTCACHE_HPP
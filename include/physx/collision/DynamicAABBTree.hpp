@@ -0,0 +1,108 @@
+/**
+ * @file DynamicAABBTree.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_DYNAMICAABBTREE_HPP
+#define PHYSX_DYNAMICAABBTREE_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "AABB.hpp"
+#include "UniformGrid.hpp"
+
+namespace physx::collision {
+    /**
+     * @brief @c DynamicAABBTree class.
+     *
+     * An incrementally updated bounding volume hierarchy. Each body is a leaf holding a fat box, its bounds grown by
+     * a margin, and a leaf is only reinserted once the body escapes its fat box. Inserts pick a sibling with the
+     * perimeter (surface area) heuristic and rotations keep the tree balanced, so finding the pairs of @c n bodies
+     * is close to O(n log n) no matter how much their sizes differ.
+     * @namespace @c physx::collision
+     */
+    class DynamicAABBTree {
+    public:
+        static constexpr math::i32 nullNode{-1};
+
+        explicit DynamicAABBTree(math::f32 margin = 2.f);
+        ~DynamicAABBTree() = default;
+
+        void update(const AABB* boxes, std::size_t count);
+        void findPairs(std::vector<CollisionPair>& pairs) const;
+        void clear();
+
+        template<typename Function>
+        void query(const AABB& box, Function&& function) const;
+
+        void setMargin(math::f32 newMargin);
+        math::f32 getMargin() const;
+        math::i32 getHeight() const;
+        std::size_t getReinsertCount() const;
+
+    private:
+        struct Node {
+            AABB box;                   ///< Fat box for leaves, the union of the children otherwise.
+            math::i32 parent;           ///< Parent node, or the next free node while on the free list.
+            math::i32 child1;
+            math::i32 child2;
+            math::i32 height;           ///< Zero for leaves, -1 for free nodes.
+            std::uint32_t body;         ///< Body index of a leaf.
+
+            bool isLeaf() const { return child1 == nullNode; }
+        };
+
+        std::vector<Node> nodes;
+        std::vector<math::i32> bodyLeaves;              ///< Leaf of each body, @c nullNode if it has none.
+        math::i32 root{nullNode};
+        math::i32 freeList{nullNode};
+        math::f32 margin;
+        std::size_t reinsertCount{0};                   ///< Leaves reinserted by the last @c update.
+        mutable std::vector<math::i32> stack;           ///< Traversal stack reused by @c query.
+
+        math::i32 allocateNode();
+        void freeNode(math::i32 node);
+        void insertLeaf(math::i32 leaf);
+        void removeLeaf(math::i32 leaf);
+        math::i32 balance(math::i32 node);
+        void refit(math::i32 node);
+    };
+
+    /**
+     * @brief Visits the body of every leaf whose fat box overlaps a box.
+     * @tparam Function
+     *          Callable as @c function(std::uint32_t body).
+     * @param box
+     *          The box to test.
+     * @param function
+     *          Called with the body index of each overlapping leaf.
+     */
+    template<typename Function>
+    void DynamicAABBTree::query(const AABB& box, Function&& function) const {
+        if (root == nullNode) {
+            return;
+        }
+
+        stack.clear();
+        stack.push_back(root);
+        while (!stack.empty()) {
+            const Node& node{nodes[stack.back()]};
+            stack.pop_back();
+            if (!node.box.overlaps(box)) {
+                continue;
+            }
+
+            if (node.isLeaf()) {
+                function(node.body);
+            } else {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+        }
+    }
+} // namespace physx::collision
+
+#endif //PHYSX_DYNAMICAABBTREE_HPP
@@ -0,0 +1,35 @@
+/**
+ * @file Narrowphase.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_NARROWPHASE_HPP
+#define PHYSX_NARROWPHASE_HPP
+
+#include "../math/MathConstants.hpp"
+#include "Contact.hpp"
+
+/**
+ * Contact generation between pairs of shapes. Boxes are axis aligned and given by their center and half extents.
+ * Segments are given by their two ends and have no thickness.
+ *
+ * Each test fills the normal, depth and points of a @c Contact, with the normal pointing from the first shape to
+ * the second, and leaves the body indices to the caller. The contact is left untouched when the shapes do not
+ * overlap.
+ */
+namespace physx::collision {
+    bool collideCircles(math::f32 ax, math::f32 ay, math::f32 aRadius, math::f32 bx, math::f32 by,
+                        math::f32 bRadius, Contact& contact);
+    bool collideCircleBox(math::f32 cx, math::f32 cy, math::f32 radius, math::f32 bx, math::f32 by,
+                          math::f32 halfWidth, math::f32 halfHeight, Contact& contact);
+    bool collideBoxes(math::f32 ax, math::f32 ay, math::f32 aHalfWidth, math::f32 aHalfHeight, math::f32 bx,
+                      math::f32 by, math::f32 bHalfWidth, math::f32 bHalfHeight, Contact& contact);
+    bool collideCircleSegment(math::f32 cx, math::f32 cy, math::f32 radius, math::f32 x0, math::f32 y0,
+                              math::f32 x1, math::f32 y1, Contact& contact);
+    bool collideBoxSegment(math::f32 bx, math::f32 by, math::f32 halfWidth, math::f32 halfHeight, math::f32 x0,
+                           math::f32 y0, math::f32 x1, math::f32 y1, Contact& contact);
+} // namespace physx::collision
+
+#endif //PHYSX_NARROWPHASE_HPP
@@ -0,0 +1,31 @@
+/**
+ * @file SolverType.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_SOLVERTYPE_HPP
+#define PHYSX_SOLVERTYPE_HPP
+
+#include <cstdint>
+
+namespace physx::collision {
+    /**
+     * @brief An enumeration of the ways a @c Simulation can iterate over its contacts.
+     */
+    enum class SolverType : std::uint8_t {
+        GaussSeidel,    ///< One contact at a time, each seeing the impulses before it. Converges fastest.
+        Jacobi          ///< Every contact at once from the same velocities, spread over the threads.
+    };
+
+    /**
+     * @brief An enumeration of the ways a @c Simulation can remove the overlap of its contacts.
+     */
+    enum class PositionCorrection : std::uint8_t {
+        Baumgarte,      ///< Asks the velocity solver to separate overlapping bodies, which adds energy.
+        SplitImpulse    ///< Moves overlapping bodies apart in a separate pass that leaves their velocity alone.
+    };
+} // namespace physx::collision
+
+#endif //PHYSX_SOLVERTYPE_HPP
@@ -0,0 +1,137 @@
+/**
+ * @file StaticWorld.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_STATICWORLD_HPP
+#define PHYSX_STATICWORLD_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "../math/Vec2.hpp"
+#include "AABB.hpp"
+
+namespace physx::collision {
+    /**
+     * @brief An enumeration of the shapes of static world geometry.
+     */
+    enum class StaticShapeType : std::uint8_t {
+        Segment,    ///< A line with no thickness, solid from both sides.
+        Box,        ///< A solid axis aligned box.
+        Circle      ///< A solid circle.
+    };
+
+    /**
+     * @brief One piece of static world geometry. Fields a shape does not use are zero.
+     */
+    struct StaticShape {
+        StaticShapeType type;
+        math::f32 x;                ///< Start of a segment, center of a box or circle.
+        math::f32 y;
+        math::f32 endX;             ///< End of a segment.
+        math::f32 endY;
+        math::f32 halfWidth;        ///< Half the width of a box.
+        math::f32 halfHeight;       ///< Half the height of a box.
+        math::f32 radius;           ///< Radius of a circle.
+
+        AABB getBounds() const;
+    };
+
+    /**
+     * @brief @c StaticWorld class.
+     *
+     * The level geometry bodies collide with but never move: segments, boxes and circles, with polylines stored
+     * as their segments. The shapes are indexed by a bounding volume hierarchy that is built once by @c build,
+     * top-down by splitting at the median along the longer axis. Shapes never move, so unlike the
+     * @c DynamicAABBTree it needs no fat boxes or refitting, and its nodes sit in one array in depth-first order.
+     *
+     * Queries keep their traversal stack on the call stack, so any number of threads can query at once.
+     * @namespace @c physx::collision
+     */
+    class StaticWorld {
+    public:
+        StaticWorld() = default;
+        ~StaticWorld() = default;
+
+        std::size_t addSegment(const math::Vec2f& start, const math::Vec2f& end);
+        std::size_t addBox(const math::Vec2f& center, math::f32 width, math::f32 height);
+        std::size_t addCircle(const math::Vec2f& center, math::f32 radius);
+        std::size_t addPolyline(const std::vector<math::Vec2f>& points, bool closed);
+        void clear();
+
+        void build();
+        bool isBuilt() const;
+        std::size_t size() const;
+        bool isEmpty() const;
+        std::uint64_t getRevision() const;
+        AABB getBounds() const;
+        const std::vector<StaticShape>& getShapes() const;
+
+        template<typename Function>
+        void query(const AABB& box, Function&& function) const;
+
+    private:
+        static constexpr std::size_t maxLeafShapes{4};
+        static constexpr std::size_t maxDepth{64};      ///< Traversal stack size, more than a median split tree needs
+
+        struct Node {
+            AABB box;
+            std::uint32_t first;    ///< First entry in @c leafShapes of a leaf, second child of an inner node.
+            std::uint32_t count;    ///< Shapes in a leaf, zero for inner nodes, whose first child follows them.
+        };
+
+        std::vector<StaticShape> shapes;
+        std::vector<Node> nodes;
+        std::vector<std::uint32_t> leafShapes;          ///< Shape indices grouped by leaf
+        std::vector<AABB> shapeBounds;                  ///< Bounds of each shape
+        std::uint64_t revision{0};                      ///< Incremented whenever the shapes change
+        bool built{true};
+
+        std::size_t addShape(const StaticShape& shape);
+        std::uint32_t buildNode(std::size_t first, std::size_t last);
+    };
+
+    /**
+     * @brief Visits every shape whose bounds overlap a box. Only valid after @c build.
+     * @tparam Function
+     *          Callable as @c function(const StaticShape& shape).
+     * @param box
+     *          The box to test.
+     * @param function
+     *          Called with each overlapping shape.
+     */
+    template<typename Function>
+    void StaticWorld::query(const AABB& box, Function&& function) const {
+        if (nodes.empty()) {
+            return;
+        }
+
+        std::uint32_t stack[maxDepth];
+        std::size_t top{0};
+        stack[top++] = 0;
+        while (top > 0) {
+            const std::uint32_t index{stack[--top]};
+            const Node& node{nodes[index]};
+            if (!node.box.overlaps(box)) {
+                continue;
+            }
+
+            if (node.count > 0) {
+                for (std::uint32_t k{node.first}; k < node.first + node.count; ++k) {
+                    const StaticShape& shape{shapes[leafShapes[k]]};
+                    if (shapeBounds[leafShapes[k]].overlaps(box)) {
+                        function(shape);
+                    }
+                }
+            } else {
+                stack[top++] = node.first;
+                stack[top++] = index + 1;
+            }
+        }
+    }
+} // namespace physx::collision
+
+#endif //PHYSX_STATICWORLD_HPP
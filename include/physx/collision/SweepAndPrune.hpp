@@ -0,0 +1,60 @@
+/**
+ * @file SweepAndPrune.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_SWEEPANDPRUNE_HPP
+#define PHYSX_SWEEPANDPRUNE_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "AABB.hpp"
+#include "UniformGrid.hpp"
+
+namespace physx::collision {
+    /**
+     * @brief @c SweepAndPrune class.
+     *
+     * A sort-and-sweep broadphase along the x-axis. The sorted array of box endpoints is kept between updates and
+     * re-sorted with an insertion sort, so when bodies barely move from one step to the next, as in a settled pile,
+     * sorting costs close to O(n). The sweep then reports every pair whose boxes overlap on both axes.
+     * @namespace @c physx::collision
+     */
+    class SweepAndPrune {
+    public:
+        SweepAndPrune() = default;
+        ~SweepAndPrune() = default;
+
+        void update(const AABB* boxes, std::size_t count);
+        void findPairs(const AABB* boxes, std::vector<CollisionPair>& pairs);
+        void clear();
+
+        std::size_t getSwapCount() const;
+
+    private:
+        /**
+         * @brief The start or end of a body's box along the x-axis.
+         */
+        struct Endpoint {
+            math::f32 value;
+            std::uint32_t data;     ///< Body index shifted left by one, with the low bit set for the end.
+
+            std::uint32_t body() const { return data >> 1; }
+            bool isMax() const { return (data & 1) != 0; }
+        };
+
+        std::vector<Endpoint> endpoints;        ///< Sorted by value, starts before ends at equal values.
+        std::vector<std::uint8_t> tracked;      ///< Whether each body has endpoints.
+        std::vector<std::uint32_t> active;      ///< Bodies whose box contains the sweep position.
+        std::vector<std::uint32_t> activeSlot;  ///< Position of each active body in @c active.
+        std::size_t swapCount{0};               ///< Endpoint swaps made by the last @c update.
+
+        static bool less(const Endpoint& lhs, const Endpoint& rhs);
+        void insertionSort();
+    };
+} // namespace physx::collision
+
+#endif //PHYSX_SWEEPANDPRUNE_HPP
@@ -0,0 +1,128 @@
+/**
+ * @file UniformGrid.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_UNIFORMGRID_HPP
+#define PHYSX_UNIFORMGRID_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "../math/Vec2.hpp"
+
+namespace physx::collision {
+    /**
+     * @brief A pair of body indices whose bounds may overlap.
+     */
+    struct CollisionPair {
+        std::uint32_t a;    ///< Index of the first body.
+        std::uint32_t b;    ///< Index of the second body.
+    };
+
+    /**
+     * @brief @c UniformGrid class.
+     *
+     * A cell list broadphase over a fixed rectangular region. Bodies are bucketed by their center into square
+     * cells that are at least as wide as the largest body diameter, so any two overlapping bodies are always in the
+     * same or in neighbouring cells. The grid is rebuilt from scratch every step with a counting sort, which keeps
+     * both the build and the pair search linear in the number of bodies.
+     * @namespace @c physx::collision
+     */
+    class UniformGrid {
+    public:
+        UniformGrid(const math::Vec2f& min, const math::Vec2f& max);
+        ~UniformGrid() = default;
+
+        void setBounds(const math::Vec2f& min, const math::Vec2f& max);
+        void build(const math::f32* x, const math::f32* y, std::size_t count, math::f32 minCellSize,
+                   const std::uint8_t* active = nullptr);
+        void findPairs(std::vector<CollisionPair>& pairs) const;
+
+        template<typename Function>
+        void forEachPair(math::i32 column, math::i32 row, Function&& function) const;
+
+        math::f32 getCellSize() const;
+        math::i32 getColumns() const;
+        math::i32 getRows() const;
+
+    private:
+        static constexpr math::i32 maxCellsPerAxis{1024}; ///< Caps memory use when bodies are tiny.
+
+        math::Vec2f min;
+        math::Vec2f max;
+        math::f32 cellSize{1.f};
+        math::i32 columns{1};
+        math::i32 rows{1};
+
+        std::vector<std::uint32_t> bodyCells;     ///< The cell each body was binned into.
+        std::vector<std::uint32_t> cellStart;     ///< Offset of each cell's first body in @c cellBodies.
+        std::vector<std::uint32_t> cellBodies;    ///< Body indices sorted by cell.
+        std::vector<std::uint32_t> cellFill;      ///< Scratch write cursors used while scattering.
+        std::vector<std::uint8_t> cellActive;     ///< Whether each cell holds an active body, empty if all are.
+
+        math::i32 toCell(math::f32 value, math::f32 origin, math::i32 cells) const;
+    };
+
+    /**
+     * @brief Visits every candidate pair owned by one cell.
+     *
+     * A cell owns the pairs within itself and the pairs it forms with its right, bottom-left, bottom and
+     * bottom-right neighbours, so visiting every cell reports each candidate pair exactly once. Visiting a cell only
+     * touches bodies in columns @p column - 1 to @p column + 1 and rows @p row to @p row + 1, which lets cells three
+     * apart on both axes be visited concurrently. When the grid was built with an activity mask, pairs between two
+     * cells without an active body are skipped.
+     * @tparam Function
+     *          Callable as @c function(std::uint32_t a, std::uint32_t b).
+     * @param column
+     *          The column of the cell.
+     * @param row
+     *          The row of the cell.
+     * @param function
+     *          Called with the body indices of each pair.
+     */
+    template<typename Function>
+    void UniformGrid::forEachPair(math::i32 column, math::i32 row, Function&& function) const {
+        static constexpr math::i32 offsets[4][2]{{1, 0}, {-1, 1}, {0, 1}, {1, 1}};
+
+        const auto cell{static_cast<std::uint32_t>(row * columns + column)};
+        const std::uint32_t begin{cellStart[cell]};
+        const std::uint32_t end{cellStart[cell + 1]};
+        if (begin == end) {
+            return;
+        }
+
+        const bool active{cellActive.empty() || cellActive[cell] != 0};
+        if (active) {
+            for (std::uint32_t i{begin}; i < end; ++i) {
+                for (std::uint32_t k{i + 1}; k < end; ++k) {
+                    function(cellBodies[i], cellBodies[k]);
+                }
+            }
+        }
+
+        for (const auto& offset : offsets) {
+            const math::i32 neighbourColumn{column + offset[0]};
+            const math::i32 neighbourRow{row + offset[1]};
+            if (neighbourColumn < 0 || neighbourColumn >= columns || neighbourRow >= rows) {
+                continue;
+            }
+
+            const auto neighbour{static_cast<std::uint32_t>(neighbourRow * columns + neighbourColumn)};
+            if (!active && cellActive[neighbour] == 0) {
+                continue;
+            }
+
+            for (std::uint32_t i{begin}; i < end; ++i) {
+                for (std::uint32_t k{cellStart[neighbour]}; k < cellStart[neighbour + 1]; ++k) {
+                    function(cellBodies[i], cellBodies[k]);
+                }
+            }
+        }
+    }
+} // namespace physx::collision
+
+
+#endif //PHYSX_UNIFORMGRID_HPP
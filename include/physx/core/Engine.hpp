@@ -10,13 +10,28 @@
 
 #include <SFML/Graphics.hpp>
 #include <llog/llog.hpp>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
 
-#include "../utilities/FixedClock.hpp"
+#include "../utilities/FixedTimestep.hpp"
+#include "../utilities/Mouse.hpp"
+#include "../utilities/SpscRing.hpp"
+#include "../utilities/TrajectoryRecorder.hpp"
+#include "../utilities/TripleBuffer.hpp"
+#include "InputLog.hpp"
+#include "RenderSnapshot.hpp"
 #include "Renderer.hpp"
 
 namespace physx::core {
     /**
      * @brief @c Engine class.
+     *
+     * Runs the physics on its own thread while the calling thread handles the window and draws. After its steps the
+     * physics thread publishes a @c RenderSnapshot through a triple buffer, and mouse spawns travel the other way
+     * through a ring, so neither thread ever waits for the other and the physics rate is independent of the
+     * frame rate limit. The @c Simulation must only be touched through the @c Engine while it runs.
      * @namespace @c physx::core
      */
     class Engine {
@@ -27,16 +42,39 @@ namespace physx::core {
         void startSimulation();
         void setSimulation(Simulation* simulation);
 
+        void setPhysicsRate(math::f32 rate);
+        void setSubSteps(std::size_t subSteps);
+        void setMaxStepsPerFrame(std::size_t maxStepsPerFrame);
+        void setFramerateLimit(unsigned int limit);
+        void startRecording(const std::string& path);
+        void stopRecording();
+        void setDeterministic(std::uint64_t seed);
+        void startReplay(const std::string& path);
+        void saveInputLog(const std::string& path);
+
     private:
         Simulation* simulation;
         Renderer* renderer;
         sf::RenderWindow* window{nullptr};
         sf::Event event;
-        utils::FixedClock dtClock;
-        float deltaTime;
+        utils::FixedTimestep timestep{60.f, 1, 5};    ///< 60Hz physics, catching up at most 5 steps at a time
+        bool mousePressed{false};
+        std::thread physicsThread;
+        std::atomic<bool> running{false};                       ///< Cleared to stop the physics thread
+        utils::TripleBuffer<RenderSnapshot> snapshots;          ///< Physics thread to render thread
+        utils::SpscRing<math::Vec2f> spawnQueue{64};            ///< Mouse spawn positions, render to physics thread
+        std::unique_ptr<utils::TrajectoryRecorder> recorder;   ///< Records every physics step while set
+        InputLog inputLog;                                      ///< Every spawn, applied at the start of its step
+        bool deterministic{false};                              ///< Steps run back to back, ignoring the clock
+        bool replaying{false};                                  ///< Spawns come from @c inputLog, not the mouse
 
         void updateEvents();
-        void updateDeltaClock();
+        void checkForMouseEvents();
+        void physicsLoop();
+        void stopPhysics();
+        void drainSpawnQueue();
+        void stepSimulation(std::size_t steps);
+        void publishSnapshot();
         void endSimulation();
         void setupWindow();
         void setupRenderer();
@@ -0,0 +1,78 @@
+/**
+ * @file InputLog.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_INPUTLOG_HPP
+#define PHYSX_INPUTLOG_HPP
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Simulation.hpp"
+#include "../exceptions/SceneLoadException.hpp"
+
+namespace physx::core {
+    /**
+     * @brief A body added to the simulation by user input, and the step it is added before.
+     */
+    struct SpawnCommand {
+        std::uint64_t step;
+        dynamic::ShapeType shape;
+        math::f32 width;            ///< Radius of a circle
+        math::f32 height;           ///< Unused for a circle
+        math::Vec2f position;
+        bool rb;
+        dynamic::IntegrationType integration;
+    };
+
+    /**
+     * @brief @c InputLog class.
+     *
+     * Records every input that changes a @c Simulation, together with the RNG seed and step size of the run, so the
+     * run can be replayed. Inputs only take effect through @c apply at the start of a step, both when recording and
+     * when replaying, so a replay starting from the same scene reaches a bit-identical state at every step.
+     *
+     * Logs are saved as text, one command per line, with floats in hexadecimal so they read back exactly:
+     *
+     * - @c seed <seed>
+     * - @c dt <step-size>
+     * - @c circle <step> <radius> <x> <y> <dynamic|static> <euler|verlet|rk4>
+     * - @c rectangle <step> <width> <height> <x> <y> <dynamic|static> <euler|verlet|rk4>
+     * @namespace @c physx::core
+     */
+    class InputLog {
+    public:
+        InputLog() = default;
+        ~InputLog() = default;
+
+        void add(const SpawnCommand& command);
+        std::size_t apply(Simulation& simulation);
+        void rewind();
+        void clear();
+
+        void save(const std::string& path) const;
+        void save(std::ostream& output) const;
+        void load(const std::string& path);
+        void load(std::istream& input);
+
+        void setSeed(std::uint64_t newSeed);
+        std::uint64_t getSeed() const;
+        void setStepSize(math::f32 newStepSize);
+        math::f32 getStepSize() const;
+        const std::vector<SpawnCommand>& getCommands() const;
+
+    private:
+        std::uint64_t seed{0};
+        math::f32 stepSize{1.f / 60.f};
+        std::vector<SpawnCommand> commands;     ///< Sorted by step
+        std::size_t next{0};                    ///< The first command not applied yet
+    };
+} // namespace physx::core
+
+#endif //PHYSX_INPUTLOG_HPP
@@ -0,0 +1,43 @@
+/**
+ * @file RenderSnapshot.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_RENDERSNAPSHOT_HPP
+#define PHYSX_RENDERSNAPSHOT_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "Simulation.hpp"
+
+namespace physx::core {
+    /**
+     * @brief A copy of the state a @c Renderer draws, taken after a physics step.
+     *
+     * Only the arrays the renderer reads are copied, so the physics thread can keep stepping the @c Simulation
+     * while a frame is drawn from the copy. The vectors keep their capacity, so capturing into a reused snapshot
+     * only allocates when the body count grows. The colliders rarely change, so they are only copied again when
+     * their revision moves on.
+     */
+    struct RenderSnapshot {
+        std::uint64_t step{0};                  ///< Steps the simulation had run when the snapshot was taken
+        math::Vec2f constraintCenter;
+        math::f32 constraintRadius{0.f};        ///< Zero when there is no boundary
+        std::uint64_t colliderRevision{0};      ///< @c collision::StaticWorld::getRevision of @c colliders
+        std::vector<collision::StaticShape> colliders;
+        std::vector<dynamic::ShapeType> shape;
+        std::vector<math::f32> positionX;
+        std::vector<math::f32> positionY;
+        std::vector<math::f32> radius;
+        std::vector<math::f32> width;
+        std::vector<math::f32> height;
+
+        void capture(const Simulation& simulation);
+        std::size_t size() const;
+    };
+} // namespace physx::core
+
+#endif //PHYSX_RENDERSNAPSHOT_HPP
@@ -10,11 +10,18 @@
 
 #include <SFML/Graphics.hpp>
 
-#include "Simulation.hpp"
+#include "RenderSnapshot.hpp"
 
 namespace physx::core {
     /**
      * @brief @c Renderer class.
+     *
+     * Draws every circle as a textured quad from one pre-rendered circle texture, and every rectangle as a plain
+     * quad. Each shape is batched into a single vertex array, so a frame costs a handful of draw calls regardless
+     * of the number of bodies. The colliders are batched the same way, and only rebuilt when they change.
+     *
+     * The renderer only reads a @c RenderSnapshot, never the @c Simulation itself, so it can draw on one thread
+     * while another keeps stepping the simulation.
      * @namespace physx::core
      */
     class Renderer {
@@ -22,10 +29,24 @@ namespace physx::core {
         Renderer(sf::RenderTarget* target);
         ~Renderer() = default;
 
-        void render(Simulation simulation);
+        void render(const RenderSnapshot& snapshot);
 
     private:
+        static constexpr unsigned int circleTextureSize{64};   ///< Resolution of the pre-rendered circle.
+
         sf::RenderTarget* target;
+        sf::RenderTexture circleTexture;
+        sf::CircleShape boundary;
+        sf::VertexArray circles{sf::Quads};
+        sf::VertexArray rectangles{sf::Quads};
+        sf::VertexArray colliderCircles{sf::Quads};
+        sf::VertexArray colliderBoxes{sf::Quads};
+        sf::VertexArray colliderSegments{sf::Lines};
+        std::uint64_t colliderRevision{0};      ///< Revision the collider arrays were built from
+
+        void setupCircleTexture();
+        void buildBatches(const RenderSnapshot& snapshot);
+        void buildColliderBatches(const RenderSnapshot& snapshot);
     };
 } // namespace physx::core
 
@@ -0,0 +1,63 @@
+/**
+ * @file SceneLoader.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_SCENELOADER_HPP
+#define PHYSX_SCENELOADER_HPP
+
+#include <istream>
+#include <sstream>
+#include <string>
+
+#include "Simulation.hpp"
+#include "../exceptions/SceneLoadException.hpp"
+
+namespace physx::core {
+    /**
+     * @brief @c SceneLoader class.
+     *
+     * Populates a @c Simulation from a line-based text scene description. Blank lines and lines starting with
+     * @c # are ignored. Every other line is one command:
+     *
+     * - @c threads <count>
+     * - @c broadphase <grid|tree|sap>
+     * - @c solver <gs|jacobi> <iterations>
+     * - @c correction <baumgarte|split> <factor>
+     * - @c sleep <on|off> or @c sleep <speed> <steps>
+     * - @c boundary <radius> <x> <y> or @c boundary off - the circle every body is kept inside.
+     * - @c collider segment <x0> <y0> <x1> <y1>
+     * - @c collider box <width> <height> <x> <y>
+     * - @c collider circle <radius> <x> <y>
+     * - @c collider polyline <open|closed> <x0> <y0> <x1> <y1> ... - one segment between each pair of points.
+     * - @c snapshot <path> - replaces every body added so far with the bodies of a binary snapshot and drops every
+     *   joint, spring and pin added so far.
+     * - @c circle <radius> <x> <y> [static]
+     * - @c rectangle <width> <height> <x> <y> [static]
+     * - @c fill <count> <radius> - packs circles into the bottom of the circular boundary.
+     * - @c joint <a> <b> [length] - a distance joint between the bodies added @c a th and @c b th, counting from
+     *   zero. Without a length the current distance is kept.
+     * - @c spring <a> <b> <stiffness> <damping> [length]
+     * - @c pin <body> <x> <y> [length] - without a length the body is held at the point.
+     * - @c rope <links> <radius> <x> <y> - a horizontal chain of circles starting at the point, pinned there.
+     * @namespace @c physx::core
+     */
+    class SceneLoader {
+    public:
+        SceneLoader() = delete;
+
+        static void load(const std::string& path, Simulation& simulation);
+        static void load(std::istream& input, Simulation& simulation);
+
+    private:
+        static bool addCollider(std::istringstream& stream, collision::StaticWorld& colliders);
+        static void fill(Simulation& simulation, std::size_t count, math::f32 radius);
+        static void rope(Simulation& simulation, std::size_t links, math::f32 radius, const math::Vec2f& start);
+        static bool isBody(Simulation& simulation, std::size_t index);
+        static object::Object2D getObject(Simulation& simulation, std::size_t index);
+    };
+} // namespace physx::core
+
+#endif //PHYSX_SCENELOADER_HPP
@@ -8,12 +8,27 @@
 #ifndef PHYSX_SIMULATION_HPP
 #define PHYSX_SIMULATION_HPP
 
+#include <memory>
+#include <string>
 #include <vector>
 
+#include "../collision/BroadphaseType.hpp"
+#include "../collision/Contact.hpp"
+#include "../collision/ContactCache.hpp"
+#include "../collision/DynamicAABBTree.hpp"
+#include "../collision/SolverType.hpp"
+#include "../collision/StaticWorld.hpp"
+#include "../collision/SweepAndPrune.hpp"
+#include "../collision/UniformGrid.hpp"
 #include "../core/objects/Circle2D.hpp"
 #include "../core/objects/Rectangle2D.hpp"
+#include "../dynamic/ConstraintStore.hpp"
+#include "../dynamic/RigidBody2D.hpp"
+#include "../utilities/Profiler.hpp"
+#include "../utilities/Tracer.hpp"
 #include "../utilities/Vec2Utils.hpp"
-#include "../utilities/Mouse.hpp"
+#include "../utilities/ThreadPool.hpp"
+#include "../utilities/Vec2Batch.hpp"
 #include "../utilities/Utils.hpp"
 
 namespace physx::core {
@@ -24,29 +39,163 @@ namespace physx::core {
     class Simulation {
     public:
         Simulation();
-        ~Simulation();
+        ~Simulation() = default;
 
         void update(math::f32 dt);
+        std::uint64_t getStepCount() const;
 
-        void addCircleObject(math::f32 radius, const math::Vec2f& position, bool rb, dynamic::IntegrationType integrationType = dynamic::IntegrationType::Verlet);
-        void addRectangleObject(math::f32 width, math::f32 height, const math::Vec2f& position, bool rb, dynamic::IntegrationType integrationType = dynamic::IntegrationType::Verlet);
-        void addObject(object::Object2D* obj);
-        std::vector<object::Object2D*> getObjects();
+        object::Circle2D addCircleObject(math::f32 radius, const math::Vec2f& position, bool rb, dynamic::IntegrationType integrationType = dynamic::IntegrationType::Verlet);
+        object::Rectangle2D addRectangleObject(math::f32 width, math::f32 height, const math::Vec2f& position, bool rb, dynamic::IntegrationType integrationType = dynamic::IntegrationType::Verlet);
+        void removeObject(const object::Object2D& object);
+        std::size_t addDistanceJoint(const object::Object2D& a, const object::Object2D& b, math::f32 length = -1.f);
+        std::size_t addSpring(const object::Object2D& a, const object::Object2D& b, math::f32 stiffness,
+                              math::f32 damping, math::f32 length = -1.f);
+        std::size_t addPin(const object::Object2D& object, const math::Vec2f& anchor, math::f32 length = 0.f);
+        std::vector<object::Object2D> getObjects();
+        dynamic::BodyStore& getBodies();
+        const dynamic::BodyStore& getBodies() const;
+        dynamic::ConstraintStore& getJoints();
+        const dynamic::ConstraintStore& getJoints() const;
+        collision::StaticWorld& getColliders();
+        const collision::StaticWorld& getColliders() const;
+        utils::Profiler& getProfiler();
+        const utils::Profiler& getProfiler() const;
+        utils::Tracer& getTracer();
+        const utils::Tracer& getTracer() const;
+        void saveSnapshot(const std::string& path) const;
+        void loadSnapshot(const std::string& path);
+
+        void setThreadCount(std::size_t threadCount);
+        std::size_t getThreadCount() const;
+        void setBroadphase(collision::BroadphaseType type);
+        collision::BroadphaseType getBroadphase() const;
+        void setSleepEnabled(bool enabled);
+        void setSleepThreshold(math::f32 speed, std::uint16_t steps);
+        bool isSleepEnabled() const;
+        std::size_t getSleepingCount() const;
+        void setWarmStartEnabled(bool enabled);
+        bool isWarmStartEnabled() const;
+        void setSolver(collision::SolverType type, std::size_t iterations);
+        collision::SolverType getSolver() const;
+        std::size_t getSolverIterations() const;
+        void setPositionCorrection(collision::PositionCorrection type, math::f32 factor);
+        collision::PositionCorrection getPositionCorrection() const;
+
+        void setBoundary(const math::Vec2f& center, math::f32 radius);
+        bool hasBoundary() const;
+        const math::Vec2f& getConstraintCenter() const;
+        math::f32 getConstraintRadius() const;
 
     private:
-        std::vector<object::Object2D*> objects;
+        using CollisionHandler = bool (Simulation::*)(std::size_t a, std::size_t b, collision::Contact& contact) const;
+
+        ///< Narrowphase handlers indexed by the shapes of the two bodies, @c nullptr where unsupported.
+        static const CollisionHandler collisionHandlers[dynamic::shapeTypeCount][dynamic::shapeTypeCount];
+        static constexpr std::size_t cellsPerBlock{64};   ///< Grid cells whose contacts share one buffer.
+
+        dynamic::BodyStore bodies;                    ///< Every body in the simulation
+        dynamic::ConstraintStore joints;              ///< Distance joints, springs and pins between the bodies
+        std::uint64_t stepCount{0};                   ///< Number of calls to @c update so far
 
         math::Vec2f gravity{0.f, 1000.f};     ///< Gravity
         math::f32 restitution{0.2f};          ///< Elasticity of a collision
         math::f32 friction{0.1f};             ///< Friction coefficient
+        math::f32 restitutionSpeed{60.f};     ///< Approach speed below which a collision does not bounce
+        math::f32 mass{500.f};                ///< Mass given to new bodies
+
+        math::Vec2f constraintCenter{500.f, 500.f};   ///< Center of the circular boundary
+        math::f32 constraintRadius{450.f};            ///< Radius of the circular boundary, zero for none
+        collision::StaticWorld colliders;             ///< Static level geometry the bodies are kept out of
+
+        collision::BroadphaseType broadphase{collision::BroadphaseType::UniformGrid};
+        collision::UniformGrid grid;                  ///< Broadphase over the boundary and the colliders
+        collision::DynamicAABBTree tree;              ///< Broadphase for bodies of very different sizes
+        collision::SweepAndPrune sweepAndPrune;       ///< Broadphase for settled scenes
+        std::vector<collision::AABB> bounds;          ///< Bounds of each body, for the pair list broadphases
+        std::vector<collision::CollisionPair> pairs;  ///< Candidate pairs from the pair list broadphases
+        std::unique_ptr<utils::ThreadPool> threadPool;
+        utils::Profiler profiler;                     ///< Phase timings and counters, see @c PHYSX_PROFILING
+        utils::Tracer tracer;                         ///< Binary event trace, see @c PHYSX_TRACING
+
+        bool sleepEnabled{true};
+        math::f32 sleepSpeed{3.f};            ///< Speed below which a body counts as resting
+        std::uint16_t sleepSteps{30};         ///< Steps an island has to rest before it sleeps
+        std::vector<collision::Contact> contacts;                     ///< Touching pairs of this step, in a fixed order
+        std::vector<std::vector<collision::Contact>> blockContacts;   ///< Contacts found in each block of grid cells
+        collision::ContactCache contactCache;                         ///< Impulses of last step's contacts
+        bool warmStartEnabled{true};
+
+        collision::SolverType solver{collision::SolverType::GaussSeidel};
+        std::size_t solverIterations{4};
+        collision::PositionCorrection positionCorrection{collision::PositionCorrection::SplitImpulse};
+        math::f32 correctionFactor{0.8f};     ///< Share of the overlap removed per pass
+        math::f32 penetrationSlop{0.1f};      ///< Overlap left alone, so resting contacts keep touching
+        math::f32 maxLinearCorrection{2.f};   ///< Most overlap one correction pass removes from a contact
+        math::f32 maxStepCorrection{8.f};     ///< Most overlap the passes of one step remove from a contact
+        std::vector<std::uint32_t> bodyContactStart;  ///< Offset of each body's first entry in @c bodyContacts
+        std::vector<std::uint32_t> bodyContacts;      ///< Contact indices grouped by body, for Jacobi passes
+        std::vector<std::uint32_t> bodyContactFill;   ///< Scratch write cursors used while grouping
+        std::vector<math::Vec2f> contactImpulses;     ///< What each contact applies in a Jacobi pass
+        std::vector<std::uint32_t> boundaryBodies;    ///< Bodies touching the boundary, held on it by the solver
+        std::vector<std::uint32_t> islandParents;                     ///< Union-find forest over the bodies
+        std::vector<std::uint16_t> islandSleepFrames;                 ///< Fewest rest steps in each island
+        std::vector<std::uint32_t> islandHeads;                       ///< First body put to sleep in each island
 
-        void checkForMouseEvents();
         void updatePositions(math::f32 dt);
         void applyGravity();
         void applyConstraints();
+        void stopAtBoundary();
+        math::f32 getBoundaryGap(std::size_t index, math::Vec2f& normal) const;
+        void constrainRectangles();
+        void constrainToColliders();
+        bool collideStatic(std::size_t body, const collision::StaticShape& shape,
+                           collision::Contact& contact) const;
+        bool sweepSegment(std::size_t body, const math::Vec2f& previous, const collision::StaticShape& segment,
+                          collision::Contact& contact) const;
+        void updateGridBounds();
         void checkCollisions(math::f32 dt);
-        bool checkSATCollision(object::Circle2D& a, object::Circle2D& b);
-        void handleCollisionResponse(object::Circle2D& a, object::Circle2D& b);
+        void checkGridCollisions();
+        void checkPairCollisions();
+        void updateBounds();
+        void collideCell(math::i32 column, math::i32 row, std::vector<collision::Contact>& out);
+        void collidePair(std::size_t a, std::size_t b, std::vector<collision::Contact>& out);
+        void solveConstraints(math::f32 dt);
+        void updateSleep(math::f32 dt);
+        std::uint32_t findIsland(std::uint32_t body);
+        bool collideCircles(std::size_t a, std::size_t b, collision::Contact& contact) const;
+        bool collideCircleRectangle(std::size_t a, std::size_t b, collision::Contact& contact) const;
+        bool collideRectangleCircle(std::size_t a, std::size_t b, collision::Contact& contact) const;
+        bool collideRectangles(std::size_t a, std::size_t b, collision::Contact& contact) const;
+        void solveContactVelocities();
+        void correctContactPositions();
+        void findBoundaryBodies();
+        void solveBoundaryVelocities();
+        math::f32 getJacobiSplit(const collision::Contact& contact) const;
+        template<typename Apply>
+        void applyJacobiPass(Apply&& apply);
+        void buildBodyContacts();
+        template<typename Function>
+        void forEachJoint(Function&& function);
+        void prepareJoints(math::f32 dt);
+        void solveJointVelocities();
+        void correctJointPositions();
+        void getJointAxis(std::size_t joint, math::Vec2f& axis, math::f32& distance) const;
+        bool isPointPin(std::size_t joint) const;
+        math::Vec2f getJointRelativeVelocity(std::size_t joint) const;
+        math::f32 getJointInverseMassSum(std::size_t joint) const;
+        std::size_t addJoint(dynamic::ConstraintType type, std::size_t a, std::size_t b, math::f32 length,
+                             math::f32 stiffness, math::f32 damping);
+        void applyJointImpulse(std::size_t joint, const math::Vec2f& impulse);
+        void prepareContact(collision::Contact& contact, math::f32 dt);
+        void handleCollisionResponse(collision::Contact& contact);
+        math::Vec2f computeContactImpulse(collision::Contact& contact, math::f32 split) const;
+        math::f32 computeContactCorrection(const collision::Contact& contact, math::f32 split) const;
+        void applyContactImpulse(const collision::Contact& contact, const math::Vec2f& impulse);
+        math::f32 getInverseMass(std::size_t index) const;
+        math::Vec2f getStepVelocity(std::size_t index) const;
+        void applyStepImpulse(std::size_t index, const math::Vec2f& change);
+        void moveBody(std::size_t index, const math::Vec2f& offset);
+        void stopStoredVelocity(std::size_t index, const math::Vec2f& normal);
     };
 } // namespace physx::core
 
@@ -19,16 +19,11 @@ namespace physx::core::object {
      */
     class Circle2D : public Object2D {
     public:
-        Circle2D(math::f32 radius, const math::Vec2f& position, bool rb = false);
-        ~Circle2D() override = default;
+        Circle2D(dynamic::BodyStore* store, std::size_t index);
+        explicit Circle2D(const Object2D& object);
+        ~Circle2D() = default;
 
-        void update(math::f32 dt) override;
         float getRadius() const;
-        float getMass() const;
-
-    private:
-        math::f32 mass{500.f};
-        math::f32 radius;
     };
 } // namespace physx::core::object
 
@@ -8,28 +8,34 @@
 #ifndef PHYSX_OBJECT2D_HPP
 #define PHYSX_OBJECT2D_HPP
 
-#include "../../dynamic/RigidBody2D.hpp"
+#include "../../dynamic/BodyStore.hpp"
 
 namespace physx::core::object {
     /**
      * @brief @c Object2D class.
+     *
+     * A lightweight handle to a body in a @c BodyStore. The body state itself lives in the store, so handles are
+     * cheap to copy and stay valid for as long as the store keeps the body.
      * @namespace @c physx::core::object
      */
     class Object2D {
     public:
-        Object2D(const math::Vec2f& position, bool rb = false);
-        virtual ~Object2D();
+        Object2D(dynamic::BodyStore* store, std::size_t index);
+        ~Object2D() = default;
 
-        virtual void update(math::f32 dt) = 0;
-
-        void addRigidBody();
-        dynamic::RigidBody2D* getRb();
+        dynamic::ShapeType getShape() const;
+        std::size_t getIndex() const;
         bool isRbEnabled() const;
 
+        math::Vec2f getPosition() const;
+        math::Vec2f getVelocity() const;
+        math::f32 getMass() const;
+        void setPosition(const math::Vec2f& newPos);
+        void setVelocity(const math::Vec2f& newVel);
+
     protected:
-        math::Vec2f position;
-        dynamic::RigidBody2D* rb;
-        bool rbEnabled{false};
+        dynamic::BodyStore* store;
+        std::size_t index;
     };
 } // namespace physx::core::object
 
@@ -13,16 +13,12 @@
 namespace physx::core::object {
     class Rectangle2D : public Object2D {
     public:
-        Rectangle2D(math::f32 width, math::f32 height, const math::Vec2f& position, bool rb = false);
-        ~Rectangle2D() override = default;
+        Rectangle2D(dynamic::BodyStore* store, std::size_t index);
+        explicit Rectangle2D(const Object2D& object);
+        ~Rectangle2D() = default;
 
-        void update(math::f32 dt) override;
         float getWidth() const;
         float getHeight() const;
-
-    private:
-        math::f32 width;
-        math::f32 height;
     };
 } // namespace physx::core::object
 
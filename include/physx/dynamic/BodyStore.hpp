@@ -0,0 +1,159 @@
+/**
+ * @file BodyStore.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_BODYSTORE_HPP
+#define PHYSX_BODYSTORE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../exceptions/SnapshotException.hpp"
+#include "../math/Vec2.hpp"
+#include "../utilities/Arena.hpp"
+#include "../utilities/MappedFile.hpp"
+#include "Integrators.hpp"
+
+namespace physx::dynamic {
+    /**
+     * @brief An enumeration of the shapes a body can have.
+     */
+    enum class ShapeType : std::uint8_t {
+        Circle,     ///< @c Circle2D.
+        Rectangle,  ///< @c Rectangle2D.
+        None        ///< A removed body whose slot is waiting to be reused.
+    };
+
+    constexpr std::size_t shapeTypeCount{3};   ///< The number of @c ShapeType values, for dispatch tables.
+
+    /**
+     * @brief @c BodyStore class.
+     *
+     * Structure-of-arrays storage for every body in a @c Simulation. Each field lives in its own contiguous array
+     * indexed by body, so the simulation phases stream through linear memory instead of chasing a pointer per body.
+     * Bodies are stored with Verlet state, where the velocity is implied by @c position - @c positionOld.
+     *
+     * Integrated bodies can be put to sleep in islands. A sleeping body drops out of its integration group, so the
+     * batched passes skip it, and waking any body of an island wakes all of it.
+     *
+     * The arrays are carved from an @c Arena, so spawning only allocates when the capacity doubles, removed slots are
+     * handed out again by @c add and destroying the store frees every array in one go. A store loaded from a
+     * snapshot uses the arrays of the mapped file in place until it first grows.
+     * @namespace @c physx::dynamic
+     */
+    class BodyStore {
+    public:
+        BodyStore() = default;
+        ~BodyStore() = default;
+
+        BodyStore(const BodyStore&) = delete;
+        BodyStore& operator=(const BodyStore&) = delete;
+
+        std::size_t add(ShapeType shape, const math::Vec2f& position, math::f32 radius, math::f32 width,
+                        math::f32 height, math::f32 mass, bool rbEnabled,
+                        IntegrationType integration = IntegrationType::Verlet);
+        void remove(std::size_t index);
+        void reserve(std::size_t newCapacity);
+        void clear();
+        std::size_t size() const;
+        std::size_t getCapacity() const;
+        std::size_t getFreeCount() const;
+        std::size_t getIntegrationCount(IntegrationType type) const;
+        std::size_t getShapeCount(ShapeType type) const;
+
+        void saveSnapshot(const std::string& path) const;
+        void loadSnapshot(const std::string& path);
+
+        void sleep(std::size_t index, std::size_t islandHead);
+        void wake(std::size_t index);
+        bool isAsleep(std::size_t index) const;
+        std::size_t getSleepingCount() const;
+
+        math::Vec2f getPosition(std::size_t index) const;
+        math::Vec2f getVelocity(std::size_t index) const;
+        void setPosition(std::size_t index, const math::Vec2f& newPos);
+        void setVelocity(std::size_t index, const math::Vec2f& newVel);
+
+        math::f32* getPositionX() { return positionX; }
+        math::f32* getPositionY() { return positionY; }
+        math::f32* getPositionOldX() { return positionOldX; }
+        math::f32* getPositionOldY() { return positionOldY; }
+        math::f32* getVelocityX() { return velocityX; }
+        math::f32* getVelocityY() { return velocityY; }
+        math::f32* getAccelerationX() { return accelerationX; }
+        math::f32* getAccelerationY() { return accelerationY; }
+        math::f32* getRadius() { return radius; }
+        math::f32* getWidth() { return width; }
+        math::f32* getHeight() { return height; }
+        math::f32* getExtent() { return extent; }
+        math::f32* getMass() { return mass; }
+        ShapeType* getShape() { return shape; }
+        std::uint8_t* getRbEnabled() { return rbEnabled; }
+        std::uint8_t* getIntegrationGroups() { return integrationGroups; }
+        IntegrationType* getIntegration() { return integration; }
+        std::uint16_t* getSleepFrames() { return sleepFrames; }
+
+        const math::f32* getPositionX() const { return positionX; }
+        const math::f32* getPositionY() const { return positionY; }
+        const math::f32* getPositionOldX() const { return positionOldX; }
+        const math::f32* getPositionOldY() const { return positionOldY; }
+        const math::f32* getVelocityX() const { return velocityX; }
+        const math::f32* getVelocityY() const { return velocityY; }
+        const math::f32* getAccelerationX() const { return accelerationX; }
+        const math::f32* getAccelerationY() const { return accelerationY; }
+        const math::f32* getRadius() const { return radius; }
+        const math::f32* getWidth() const { return width; }
+        const math::f32* getHeight() const { return height; }
+        const math::f32* getExtent() const { return extent; }
+        const math::f32* getMass() const { return mass; }
+        const ShapeType* getShape() const { return shape; }
+        const std::uint8_t* getRbEnabled() const { return rbEnabled; }
+        const std::uint8_t* getIntegrationGroups() const { return integrationGroups; }
+        const IntegrationType* getIntegration() const { return integration; }
+        const std::uint16_t* getSleepFrames() const { return sleepFrames; }
+
+    private:
+        utils::Arena arena;
+        std::size_t count{0};
+        std::size_t capacity{0};
+        std::vector<std::size_t> freeSlots;     ///< Removed slots, reused before the store grows
+        utils::MappedFile snapshot;             ///< Snapshot the arrays point into, until the store grows
+
+        math::f32* positionX{nullptr};
+        math::f32* positionY{nullptr};
+        math::f32* positionOldX{nullptr};
+        math::f32* positionOldY{nullptr};
+        math::f32* velocityX{nullptr};
+        math::f32* velocityY{nullptr};
+        math::f32* accelerationX{nullptr};
+        math::f32* accelerationY{nullptr};
+        math::f32* radius{nullptr};             ///< Circle radius, zero for other shapes.
+        math::f32* width{nullptr};              ///< Rectangle width, zero for other shapes.
+        math::f32* height{nullptr};             ///< Rectangle height, zero for other shapes.
+        math::f32* extent{nullptr};             ///< Distance kept between the center and the boundary, see
+                                                ///< @c Simulation::applyConstraints for rectangles.
+        math::f32* mass{nullptr};
+        ShapeType* shape{nullptr};
+        std::uint8_t* rbEnabled{nullptr};       ///< Whether the body is integrated (has a rigid body).
+        std::uint8_t* integrationGroups{nullptr};  ///< @c dynamic::integrationGroup bit, zero if not integrated.
+        IntegrationType* integration{nullptr};
+        std::uint8_t* asleep{nullptr};
+        std::uint16_t* sleepFrames{nullptr};    ///< Consecutive steps the body has moved slower than the threshold.
+        std::uint32_t* sleepNext{nullptr};      ///< Next body in the ring of a sleeping island.
+        std::size_t integrationCounts[integrationTypeCount]{};  ///< Integrated bodies per @c IntegrationType.
+        std::size_t shapeCounts[shapeTypeCount]{};              ///< Bodies per @c ShapeType, the @c None entry unused.
+        std::size_t sleepingCount{0};
+
+        void grow(std::size_t newCapacity);
+        template<typename Store, typename Function>
+        static void forEachSnapshotArray(Store& store, Function&& function);
+        template<typename T>
+        void relocate(T*& array, std::size_t newCapacity);
+    };
+} // namespace physx::dynamic
+
+#endif //PHYSX_BODYSTORE_HPP
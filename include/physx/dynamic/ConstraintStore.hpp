@@ -0,0 +1,93 @@
+/**
+ * @file ConstraintStore.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_CONSTRAINTSTORE_HPP
+#define PHYSX_CONSTRAINTSTORE_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "../math/MathConstants.hpp"
+
+namespace physx::dynamic {
+    /**
+     * @brief An enumeration of the constraints a @c ConstraintStore can hold.
+     */
+    enum class ConstraintType : std::uint8_t {
+        Distance,   ///< Keeps two bodies at a fixed distance, like a rigid rod.
+        Spring,     ///< Pulls two bodies towards a rest distance with a damped spring.
+        Pin         ///< Keeps a body at a fixed distance from a point in the world, zero to hold it in place.
+    };
+
+    /**
+     * @brief @c ConstraintStore class.
+     *
+     * Structure-of-arrays storage for the joints between bodies. Each field lives in its own contiguous array
+     * indexed by constraint, so a rope of many thousands of links is solved by streaming through the arrays rather
+     * than by a virtual call per link.
+     *
+     * The constraints are graph coloured so that no two constraints of a color share a body. Each color can then
+     * be solved in parallel with no locking, and the result does not depend on how the work is split. The coloring
+     * is greedy in constraint order and is rebuilt by @c buildColors after the constraints change. Constraints on a
+     * body with too many others to color go to a last color that has to be solved serially.
+     * @namespace @c physx::dynamic
+     */
+    class ConstraintStore {
+    public:
+        static constexpr std::uint32_t noBody{~std::uint32_t{0}};   ///< Second body of a pin.
+
+        ConstraintStore() = default;
+        ~ConstraintStore() = default;
+
+        std::size_t add(ConstraintType type, std::uint32_t a, std::uint32_t b, math::f32 length,
+                        math::f32 stiffness = 0.f, math::f32 damping = 0.f, math::f32 anchorX = 0.f,
+                        math::f32 anchorY = 0.f);
+        void removeBody(std::uint32_t body);
+        void clear();
+        std::size_t size() const;
+
+        bool hasColors() const;
+        void buildColors();
+        std::size_t getColorCount() const;
+        std::size_t getColorBegin(std::size_t color) const;
+        std::size_t getColorEnd(std::size_t color) const;
+        bool isColorParallel(std::size_t color) const;
+        const std::uint32_t* getOrder() const { return order.data(); }
+
+        const ConstraintType* getType() const { return type.data(); }
+        const std::uint32_t* getBodyA() const { return bodyA.data(); }
+        const std::uint32_t* getBodyB() const { return bodyB.data(); }
+        const math::f32* getLength() const { return length.data(); }
+        const math::f32* getStiffness() const { return stiffness.data(); }
+        const math::f32* getDamping() const { return damping.data(); }
+        const math::f32* getAnchorX() const { return anchorX.data(); }
+        const math::f32* getAnchorY() const { return anchorY.data(); }
+        math::f32* getImpulse() { return impulse.data(); }
+        const math::f32* getImpulse() const { return impulse.data(); }
+
+    private:
+        static constexpr std::size_t maxColors{64};     ///< Colors tracked per body, one bit each
+
+        std::vector<ConstraintType> type;
+        std::vector<std::uint32_t> bodyA;
+        std::vector<std::uint32_t> bodyB;       ///< @c noBody for pins.
+        std::vector<math::f32> length;          ///< Distance the constraint keeps or, for springs, rests at.
+        std::vector<math::f32> stiffness;       ///< Spring force per unit of stretch.
+        std::vector<math::f32> damping;         ///< Spring force per unit of stretching speed.
+        std::vector<math::f32> anchorX;         ///< World point a pin holds its body to.
+        std::vector<math::f32> anchorY;
+        std::vector<math::f32> impulse;         ///< Impulse applied along the constraint last step, to warm start.
+
+        std::vector<std::uint32_t> order;       ///< Constraint indices sorted by color
+        std::vector<std::uint32_t> colorStart;  ///< Offset of each color's first entry in @c order, plus the end
+        std::vector<std::uint64_t> bodyColors;  ///< Scratch set of the colors used on each body
+        bool colorsValid{true};
+        bool hasOverflow{false};                ///< Whether the last color is the serial one
+    };
+} // namespace physx::dynamic
+
+#endif //PHYSX_CONSTRAINTSTORE_HPP
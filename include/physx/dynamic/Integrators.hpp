@@ -0,0 +1,95 @@
+/**
+ * @file Integrators.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_INTEGRATORS_HPP
+#define PHYSX_INTEGRATORS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "RigidBody2D.hpp"
+
+/**
+ * Integration policies a batched integration loop is instantiated with.
+ *
+ * Each policy advances one axis of a body by one step. The velocity is measured per step, as the displacement over
+ * the step, which is what Verlet integration implies with @c position - @c positionOld, so every integrator leaves
+ * the same state behind and bodies can be handed between them. Every policy records the position it started from
+ * in @c positionOld. The arithmetic goes through a lane type (see @c utils::ScalarLanes), so the same policy runs on
+ * a single float or a full SIMD register.
+ */
+namespace physx::dynamic {
+    constexpr std::size_t integrationTypeCount{3};    ///< The number of @c IntegrationType values.
+
+    /**
+     * @brief Gets the bit a body integrated with @p type sets in @c BodyStore::getIntegrationGroups.
+     * @param type
+     *          The integration type.
+     * @return The group bit.
+     */
+    constexpr std::uint8_t integrationGroup(IntegrationType type) {
+        return static_cast<std::uint8_t>(1u << static_cast<std::uint8_t>(type));
+    }
+
+    /**
+     * @brief Position Verlet. The velocity is recovered from the last two positions.
+     */
+    struct VerletIntegrator {
+        static constexpr IntegrationType type{IntegrationType::Verlet};
+
+        template<typename L>
+        static void step(typename L::Float& position, typename L::Float& positionOld, typename L::Float& velocity,
+                         typename L::Float acceleration, typename L::Float dt) {
+            velocity = L::sub(position, positionOld);
+            positionOld = position;
+            position = L::add(L::add(position, velocity), L::mul(L::mul(acceleration, dt), dt));
+        }
+    };
+
+    /**
+     * @brief Semi-implicit (symplectic) Euler. The velocity is updated first and then moves the position.
+     */
+    struct EulerIntegrator {
+        static constexpr IntegrationType type{IntegrationType::Euler};
+
+        template<typename L>
+        static void step(typename L::Float& position, typename L::Float& positionOld, typename L::Float& velocity,
+                         typename L::Float acceleration, typename L::Float dt) {
+            positionOld = position;
+            velocity = L::add(velocity, L::mul(L::mul(acceleration, dt), dt));
+            position = L::add(position, velocity);
+        }
+    };
+
+    /**
+     * @brief Classic fourth-order Runge-Kutta.
+     *
+     * The acceleration is accumulated before the step and held constant over it, so all four velocity slopes equal
+     * it and the two midpoint position slopes coincide. For a constant acceleration the result is exact.
+     */
+    struct RK4Integrator {
+        static constexpr IntegrationType type{IntegrationType::RK4};
+
+        template<typename L>
+        static void step(typename L::Float& position, typename L::Float& positionOld, typename L::Float& velocity,
+                         typename L::Float acceleration, typename L::Float dt) {
+            const auto stepAcceleration{L::mul(L::mul(acceleration, dt), dt)};
+
+            const auto k1{velocity};
+            const auto k2{L::add(velocity, L::mul(stepAcceleration, L::set(0.5f)))};
+            const auto k3{k2};
+            const auto k4{L::add(velocity, stepAcceleration)};
+            const auto slope{L::add(L::add(k1, L::mul(L::add(k2, k3), L::set(2.f))), k4)};
+
+            positionOld = position;
+            position = L::add(position, L::mul(slope, L::set(1.f / 6.f)));
+            velocity = L::add(velocity, stepAcceleration);
+        }
+    };
+} // namespace physx::dynamic
+
+#endif //PHYSX_INTEGRATORS_HPP
@@ -55,6 +55,8 @@ namespace physx::dynamic {
 
         IntegrationType integration{IntegrationType::Verlet}; ///< Verlet integration by default.
 
+        template<typename Integrator>
+        void integrate(math::f32 dt);
         void integrateVerlet(math::f32 dt);
         void integrateEuler(math::f32 dt);
         void integrateRK4(math::f32 dt);
@@ -22,9 +22,9 @@ namespace physx::except {
     public:
         DivisionByZeroException(const char* message);
         DivisionByZeroException(const std::string& message);
-        ~DivisionByZeroException() _NOEXCEPT override = default;
+        ~DivisionByZeroException() noexcept override = default;
 
-        const char* what() const _NOEXCEPT override;
+        const char* what() const noexcept override;
 
     private:
         std::string message;
@@ -22,9 +22,9 @@ class InvertibleMatrixException : public std::exception {
     public:
         InvertibleMatrixException(const char* message);
         InvertibleMatrixException(const std::string& message);
-        ~InvertibleMatrixException() _NOEXCEPT override = default;
+        ~InvertibleMatrixException() noexcept override = default;
 
-        const char* what() const _NOEXCEPT override;
+        const char* what() const noexcept override;
 
     private:
         std::string message;
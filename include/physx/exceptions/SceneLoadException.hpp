@@ -0,0 +1,35 @@
+/**
+ * @file SceneLoadException.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_SCENELOADEXCEPTION_HPP
+#define PHYSX_SCENELOADEXCEPTION_HPP
+
+#include <exception>
+#include <string>
+
+namespace physx::except {
+    /**
+     * @brief @c SceneLoadException class.
+     *
+     * Inherits from @c std::exception.
+     * @namespace @c physx::except
+     */
+    class SceneLoadException : public std::exception {
+    public:
+        SceneLoadException(const char* message);
+        SceneLoadException(const std::string& message);
+        ~SceneLoadException() noexcept override = default;
+
+        const char* what() const noexcept override;
+
+    private:
+        std::string message;
+    };
+} // physx::except
+
+
+#endif //PHYSX_SCENELOADEXCEPTION_HPP
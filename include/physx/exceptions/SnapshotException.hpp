@@ -0,0 +1,35 @@
+/**
+ * @file SnapshotException.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_SNAPSHOTEXCEPTION_HPP
+#define PHYSX_SNAPSHOTEXCEPTION_HPP
+
+#include <exception>
+#include <string>
+
+namespace physx::except {
+    /**
+     * @brief @c SnapshotException class.
+     *
+     * Inherits from @c std::exception.
+     * @namespace @c physx::except
+     */
+    class SnapshotException : public std::exception {
+    public:
+        SnapshotException(const char* message);
+        SnapshotException(const std::string& message);
+        ~SnapshotException() noexcept override = default;
+
+        const char* what() const noexcept override;
+
+    private:
+        std::string message;
+    };
+} // physx::except
+
+
+#endif //PHYSX_SNAPSHOTEXCEPTION_HPP
@@ -0,0 +1,35 @@
+/**
+ * @file TrajectoryException.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_TRAJECTORYEXCEPTION_HPP
+#define PHYSX_TRAJECTORYEXCEPTION_HPP
+
+#include <exception>
+#include <string>
+
+namespace physx::except {
+    /**
+     * @brief @c TrajectoryException class.
+     *
+     * Inherits from @c std::exception.
+     * @namespace @c physx::except
+     */
+    class TrajectoryException : public std::exception {
+    public:
+        TrajectoryException(const char* message);
+        TrajectoryException(const std::string& message);
+        ~TrajectoryException() noexcept override = default;
+
+        const char* what() const noexcept override;
+
+    private:
+        std::string message;
+    };
+} // physx::except
+
+
+#endif //PHYSX_TRAJECTORYEXCEPTION_HPP
@@ -0,0 +1,71 @@
+/**
+ * @file Arena.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_ARENA_HPP
+#define PHYSX_ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace physx::utils {
+    /**
+     * @brief @c Arena class.
+     *
+     * A bump allocator that hands out memory from fixed-size slabs. Nothing is freed individually: @c reset rewinds
+     * every slab so the memory is reused without going back to the heap, and @c release (or destruction) frees all
+     * the slabs at once. Only trivially destructible types may be placed in an arena.
+     * @namespace @c physx::utils
+     */
+    class Arena {
+    public:
+        static constexpr std::size_t defaultSlabSize{1 << 20};   ///< 1 MiB
+        static constexpr std::size_t cacheLineSize{64};
+
+        explicit Arena(std::size_t slabSize = defaultSlabSize);
+        ~Arena() = default;
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        void* allocate(std::size_t bytes, std::size_t alignment);
+        void reset();
+        void release();
+
+        std::size_t getSlabCount() const;
+        std::size_t getReservedBytes() const;
+
+        /**
+         * @brief Allocates an uninitialised array aligned to a cache line.
+         * @tparam T
+         *          The element type.
+         * @param count
+         *          The number of elements.
+         * @return The array.
+         */
+        template<typename T>
+        T* allocateArray(std::size_t count) {
+            static_assert(std::is_trivially_destructible_v<T>, "Arena memory is released without destructors");
+            return static_cast<T*>(allocate(sizeof(T) * count, std::max(alignof(T), cacheLineSize)));
+        }
+
+    private:
+        struct Slab {
+            std::unique_ptr<std::byte[]> memory;
+            std::size_t size;
+        };
+
+        std::vector<Slab> slabs;
+        std::size_t slabSize;
+        std::size_t current{0};     ///< The slab being allocated from
+        std::size_t offset{0};      ///< The first free byte in the current slab
+    };
+} // namespace physx::utils
+
+#endif //PHYSX_ARENA_HPP
@@ -0,0 +1,53 @@
+/**
+ * @file FixedTimestep.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_FIXEDTIMESTEP_HPP
+#define PHYSX_FIXEDTIMESTEP_HPP
+
+#include <cstddef>
+
+#include "../math/MathConstants.hpp"
+
+namespace physx::utils {
+    /**
+     * @brief @c FixedTimestep class.
+     *
+     * Accumulates variable frame times and turns them into a whole number of fixed physics steps, each of which is
+     * split into sub-steps. The number of steps per frame is capped, and any time beyond the cap is dropped, so a
+     * slow frame cannot make the next frame slower still.
+     * @namespace @c physx::utils
+     */
+    class FixedTimestep {
+    public:
+        FixedTimestep(math::f32 rate, std::size_t subSteps, std::size_t maxStepsPerFrame);
+        ~FixedTimestep() = default;
+
+        std::size_t advance(math::f32 frameTime);
+        void reset();
+
+        void setRate(math::f32 newRate);
+        void setSubSteps(std::size_t newSubSteps);
+        void setMaxStepsPerFrame(std::size_t newMaxStepsPerFrame);
+
+        math::f32 getStepSize() const;
+        math::f32 getSubStepSize() const;
+        std::size_t getSubSteps() const;
+        math::f32 getAlpha() const;
+
+    private:
+        static constexpr math::f32 minRate{1e-3f};     ///< Slowest accepted rate, so a step is always finite
+
+        math::f32 stepSize;
+        std::size_t subSteps;
+        std::size_t maxStepsPerFrame;
+        math::f32 accumulator{0.f};
+
+        static math::f32 toStepSize(math::f32 rate);
+    };
+} // namespace physx::utils
+
+#endif //PHYSX_FIXEDTIMESTEP_HPP
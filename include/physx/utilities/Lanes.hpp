@@ -0,0 +1,110 @@
+/**
+ * @file Lanes.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_LANES_HPP
+#define PHYSX_LANES_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "../math/MathConstants.hpp"
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define PHYSX_BATCH_AVX2
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define PHYSX_BATCH_SSE2
+#endif
+
+/**
+ * Lane types that let a kernel be written once and instantiated for plain floats or for the widest SIMD registers the
+ * translation unit is built for. @c SimdLanes is only defined along with @c PHYSX_BATCH_AVX2 or @c PHYSX_BATCH_SSE2.
+ */
+namespace physx::utils {
+    /**
+     * @brief One float per lane, used for the tail of every kernel and on targets without SIMD.
+     */
+    struct ScalarLanes {
+        using Float = math::f32;
+        using Mask = bool;
+        static constexpr std::size_t width{1};
+
+        static Float load(const math::f32* p) { return *p; }
+        static void store(math::f32* p, Float v) { *p = v; }
+        static Float set(math::f32 v) { return v; }
+        static Float add(Float a, Float b) { return a + b; }
+        static Float sub(Float a, Float b) { return a - b; }
+        static Float mul(Float a, Float b) { return a * b; }
+        static Float div(Float a, Float b) { return a / b; }
+        static Float sqrt(Float a) { return std::sqrt(a); }
+        static Mask greater(Float a, Float b) { return a > b; }
+        static Mask hasBits(const std::uint8_t* p, std::uint8_t bits) { return (*p & bits) != 0; }
+        static Float select(Mask m, Float a, Float b) { return m ? a : b; }
+    };
+
+#if defined(PHYSX_BATCH_AVX2)
+    /**
+     * @brief Eight floats per lane with AVX2.
+     */
+    struct SimdLanes {
+        using Float = __m256;
+        using Mask = __m256;
+        static constexpr std::size_t width{8};
+
+        static Float load(const math::f32* p) { return _mm256_loadu_ps(p); }
+        static void store(math::f32* p, Float v) { _mm256_storeu_ps(p, v); }
+        static Float set(math::f32 v) { return _mm256_set1_ps(v); }
+        static Float add(Float a, Float b) { return _mm256_add_ps(a, b); }
+        static Float sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+        static Float mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+        static Float div(Float a, Float b) { return _mm256_div_ps(a, b); }
+        static Float sqrt(Float a) { return _mm256_sqrt_ps(a); }
+        static Mask greater(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+        static Float select(Mask m, Float a, Float b) { return _mm256_blendv_ps(b, a, m); }
+
+        static Mask hasBits(const std::uint8_t* p, std::uint8_t bits) {
+            const __m256i lanes{_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)))};
+            const __m256i masked{_mm256_and_si256(lanes, _mm256_set1_epi32(bits))};
+            return _mm256_castsi256_ps(_mm256_cmpgt_epi32(masked, _mm256_setzero_si256()));
+        }
+    };
+#elif defined(PHYSX_BATCH_SSE2)
+    /**
+     * @brief Four floats per lane with SSE2.
+     */
+    struct SimdLanes {
+        using Float = __m128;
+        using Mask = __m128;
+        static constexpr std::size_t width{4};
+
+        static Float load(const math::f32* p) { return _mm_loadu_ps(p); }
+        static void store(math::f32* p, Float v) { _mm_storeu_ps(p, v); }
+        static Float set(math::f32 v) { return _mm_set1_ps(v); }
+        static Float add(Float a, Float b) { return _mm_add_ps(a, b); }
+        static Float sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+        static Float mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+        static Float div(Float a, Float b) { return _mm_div_ps(a, b); }
+        static Float sqrt(Float a) { return _mm_sqrt_ps(a); }
+        static Mask greater(Float a, Float b) { return _mm_cmpgt_ps(a, b); }
+        static Float select(Mask m, Float a, Float b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+
+        static Mask hasBits(const std::uint8_t* p, std::uint8_t bits) {
+            std::int32_t bytes;
+            std::memcpy(&bytes, p, sizeof(bytes));
+            const __m128i zero{_mm_setzero_si128()};
+            const __m128i lanes{_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero), zero)};
+            const __m128i masked{_mm_and_si128(lanes, _mm_set1_epi32(bits))};
+            return _mm_castsi128_ps(_mm_cmpgt_epi32(masked, zero));
+        }
+    };
+#endif
+} // namespace physx::utils
+
+#endif //PHYSX_LANES_HPP
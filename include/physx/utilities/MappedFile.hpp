@@ -0,0 +1,49 @@
+/**
+ * @file MappedFile.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_MAPPEDFILE_HPP
+#define PHYSX_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace physx::utils {
+    /**
+     * @brief @c MappedFile class.
+     *
+     * A private, writable view of a whole file. On POSIX systems the file is memory-mapped copy-on-write, so pages
+     * are only read from disk when first touched and writes never reach the file. Elsewhere the file is read into
+     * memory up front. The view stays valid until the @c MappedFile is closed, moved from or destroyed.
+     * @namespace @c physx::utils
+     */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        bool open(const std::string& path);
+        void close();
+
+        std::byte* getData() { return data; }
+        const std::byte* getData() const { return data; }
+        std::size_t getSize() const { return size; }
+
+    private:
+        std::byte* data{nullptr};
+        std::size_t size{0};
+        bool mapped{false};             ///< Whether @c data is a memory mapping rather than @c buffer.
+        std::vector<std::byte> buffer;  ///< Holds the file when it cannot be mapped.
+    };
+} // namespace physx::utils
+
+#endif //PHYSX_MAPPEDFILE_HPP
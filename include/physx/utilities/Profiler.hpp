@@ -0,0 +1,147 @@
+/**
+ * @file Profiler.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_PROFILER_HPP
+#define PHYSX_PROFILER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../math/MathConstants.hpp"
+#include "Arena.hpp"
+
+namespace physx::utils {
+    /**
+     * @brief An enumeration of the timed phases of a simulation step.
+     */
+    enum class ProfilePhase : std::uint8_t {
+        Step,           ///< The whole step.
+        Integrate,
+        Constraints,
+        Gravity,
+        Broadphase,     ///< Building the grid or updating the bounds and the pair list.
+        Narrowphase,    ///< Testing the candidate pairs and filling the contact buffer.
+        Solve,          ///< Resolving the contacts.
+        Sleep
+    };
+
+    /**
+     * @brief An enumeration of the per-step counters.
+     */
+    enum class ProfileCounter : std::uint8_t {
+        BodiesIntegrated,
+        PairsTested,        ///< Candidate pairs that reached the narrowphase.
+        Contacts,           ///< Pairs found touching.
+        SleepingBodies
+    };
+
+    constexpr std::size_t profilePhaseCount{8};     ///< The number of @c ProfilePhase values.
+    constexpr std::size_t profileCounterCount{4};   ///< The number of @c ProfileCounter values.
+
+    /**
+     * @brief Aggregates of one phase or counter over the rolling window. Phase times are in milliseconds.
+     */
+    struct ProfileStats {
+        math::f64 mean;
+        math::f64 max;
+        math::f64 last;
+    };
+
+    /**
+     * @brief @c Profiler class.
+     *
+     * Collects phase times and counters for each step and keeps the last @c windowSize steps in a ring, so the
+     * aggregates always describe recent behaviour. Counters bumped inside parallel loops go to a per-thread slot and
+     * are summed once per step, so they need no atomics.
+     *
+     * Instrumentation goes through the @c PHYSX_PROFILE_* macros, which compile to nothing unless
+     * @c PHYSX_PROFILING is defined (see the @c PHYSX_ENABLE_PROFILING CMake option). Queries then return zeros.
+     * @namespace @c physx::utils
+     */
+    class Profiler {
+    public:
+        /**
+         * @brief Adds the time between its construction and destruction to a phase.
+         */
+        class ScopedTimer {
+        public:
+            ScopedTimer(Profiler& profiler, ProfilePhase phase)
+                : profiler{profiler}, phase{phase}, start{std::chrono::steady_clock::now()} {
+            }
+
+            ~ScopedTimer() {
+                profiler.addTime(phase, std::chrono::steady_clock::now() - start);
+            }
+
+            ScopedTimer(const ScopedTimer&) = delete;
+            ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        private:
+            Profiler& profiler;
+            ProfilePhase phase;
+            std::chrono::steady_clock::time_point start;
+        };
+
+        explicit Profiler(std::size_t windowSize = 120);
+        ~Profiler() = default;
+
+        void setThreadCount(std::size_t threadCount);
+        void setWindowSize(std::size_t windowSize);
+        void reset();
+
+        void addTime(ProfilePhase phase, std::chrono::steady_clock::duration duration);
+        void add(ProfileCounter counter, std::uint64_t value);
+        void addFromThread(ProfileCounter counter, std::uint64_t value);
+        void endStep();
+
+        ProfileStats getPhase(ProfilePhase phase) const;
+        ProfileStats getCounter(ProfileCounter counter) const;
+        std::size_t getSampleCount() const;
+
+        static const char* getName(ProfilePhase phase);
+        static const char* getName(ProfileCounter counter);
+
+    private:
+        struct Sample {
+            std::int64_t times[profilePhaseCount];      ///< Nanoseconds
+            std::uint64_t counters[profileCounterCount];
+        };
+
+        struct alignas(Arena::cacheLineSize) ThreadCounters {
+            std::uint64_t counters[profileCounterCount];
+        };
+
+        std::vector<Sample> window;
+        std::size_t next{0};                    ///< The sample the next step overwrites
+        std::size_t filled{0};                  ///< The number of samples recorded, up to the window size
+        Sample current{};                       ///< The step being recorded
+        std::vector<ThreadCounters> threadCounters;
+
+        template<typename Value>
+        ProfileStats aggregate(Value value) const;
+    };
+} // namespace physx::utils
+
+#define PHYSX_PROFILE_JOIN_INNER(a, b) a##b
+#define PHYSX_PROFILE_JOIN(a, b) PHYSX_PROFILE_JOIN_INNER(a, b)
+
+#if defined(PHYSX_PROFILING)
+#define PHYSX_PROFILE_SCOPE(profiler, phase) \
+    ::physx::utils::Profiler::ScopedTimer PHYSX_PROFILE_JOIN(profileScope, __LINE__){profiler, phase}
+#define PHYSX_PROFILE_COUNT(profiler, counter, value) (profiler).add(counter, value)
+#define PHYSX_PROFILE_THREAD_COUNT(profiler, counter, value) (profiler).addFromThread(counter, value)
+#define PHYSX_PROFILE_END_STEP(profiler) (profiler).endStep()
+#else
+#define PHYSX_PROFILE_SCOPE(profiler, phase) static_cast<void>(0)
+#define PHYSX_PROFILE_COUNT(profiler, counter, value) static_cast<void>(0)
+#define PHYSX_PROFILE_THREAD_COUNT(profiler, counter, value) static_cast<void>(0)
+#define PHYSX_PROFILE_END_STEP(profiler) static_cast<void>(0)
+#endif
+
+#endif //PHYSX_PROFILER_HPP
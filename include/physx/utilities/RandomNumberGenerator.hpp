@@ -8,22 +8,37 @@
 #ifndef PHYSX_RANDOMNUMBERGENERATOR_HPP
 #define PHYSX_RANDOMNUMBERGENERATOR_HPP
 
-#include <random>
+#include <cstdint>
 
 #include "../math/MathConstants.hpp"
 
 namespace physx::utils {
     /**
      * @brief @c RandomNumberGenerator class.
+     *
+     * A seeded SplitMix64 stream. The numbers are derived with plain integer and float arithmetic rather than the
+     * standard distributions, whose output differs between standard libraries, so a seed gives the same sequence on
+     * every platform. The static functions draw from one shared stream that is seeded from @c std::random_device
+     * unless @c seed is called.
      * @namespace @c physx::utils
      */
     class RandomNumberGenerator {
     public:
-        RandomNumberGenerator() = default;
+        explicit RandomNumberGenerator(std::uint64_t seed);
         ~RandomNumberGenerator() = default;
 
+        std::uint64_t next();
+        math::f32 nextFloat(math::f32 min, math::f32 max);
+        math::i32 nextInt(math::i32 min, math::i32 max);
+
         static math::f32 random(math::f32 min, math::f32 max);
         static math::i32 random(math::i32 min, math::i32 max);
+        static void seed(std::uint64_t seed);
+
+    private:
+        std::uint64_t state;
+
+        static RandomNumberGenerator& shared();
     };
 
     using RNG = RandomNumberGenerator;
@@ -0,0 +1,92 @@
+/**
+ * @file SpscRing.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_SPSCRING_HPP
+#define PHYSX_SPSCRING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "Arena.hpp"
+
+namespace physx::utils {
+    /**
+     * @brief @c SpscRing class.
+     *
+     * A bounded, lock-free ring of reusable slots shared by exactly one producer thread and one consumer thread.
+     * Slots are filled and drained in place, so elements that own memory (such as vectors) keep their capacity from
+     * one lap to the next and steady-state use does not allocate.
+     * @tparam T
+     *          The slot type.
+     * @namespace @c physx::utils
+     */
+    template<typename T>
+    class SpscRing {
+    public:
+        /**
+         * @brief @c SpscRing constructor.
+         * @param capacity
+         *          The number of slots, at least one.
+         */
+        explicit SpscRing(std::size_t capacity)
+            : slots(capacity > 0 ? capacity : 1) {
+        }
+
+        ~SpscRing() = default;
+
+        SpscRing(const SpscRing&) = delete;
+        SpscRing& operator=(const SpscRing&) = delete;
+
+        /**
+         * @brief Gets the next free slot for the producer to fill.
+         * @return The slot, or @c nullptr if the ring is full.
+         */
+        T* acquire() {
+            const std::size_t index{head.load(std::memory_order_relaxed)};
+            if (index - tail.load(std::memory_order_acquire) == slots.size()) {
+                return nullptr;
+            }
+            return &slots[index % slots.size()];
+        }
+
+        /**
+         * @brief Hands the slot returned by @c acquire to the consumer.
+         */
+        void publish() {
+            head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Gets the oldest published slot for the consumer to drain.
+         * @return The slot, or @c nullptr if the ring is empty.
+         */
+        T* peek() {
+            const std::size_t index{tail.load(std::memory_order_relaxed)};
+            if (index == head.load(std::memory_order_acquire)) {
+                return nullptr;
+            }
+            return &slots[index % slots.size()];
+        }
+
+        /**
+         * @brief Hands the slot returned by @c peek back to the producer.
+         */
+        void release() {
+            tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        std::size_t getCapacity() const { return slots.size(); }
+
+    private:
+        std::vector<T> slots;
+        alignas(Arena::cacheLineSize) std::atomic<std::size_t> head{0};   ///< Slots published, written by the producer
+        alignas(Arena::cacheLineSize) std::atomic<std::size_t> tail{0};   ///< Slots released, written by the consumer
+    };
+} // namespace physx::utils
+
+#endif //PHYSX_SPSCRING_HPP
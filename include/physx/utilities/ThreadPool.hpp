@@ -0,0 +1,61 @@
+/**
+ * @file ThreadPool.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_THREADPOOL_HPP
+#define PHYSX_THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace physx::utils {
+    /**
+     * @brief @c ThreadPool class.
+     *
+     * A fixed set of worker threads that run data-parallel loops. The calling thread takes part in every loop, so a
+     * pool with a thread count of one runs everything inline without any synchronisation.
+     * @namespace @c physx::utils
+     */
+    class ThreadPool {
+    public:
+        using RangeFunction = std::function<void(std::size_t begin, std::size_t end)>;
+
+        explicit ThreadPool(std::size_t threadCount);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        void parallelFor(std::size_t count, const RangeFunction& function);
+        std::size_t getThreadCount() const;
+
+        static std::size_t getThreadIndex();
+
+    private:
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable finished;
+
+        const RangeFunction* job{nullptr};
+        std::size_t jobCount{0};
+        std::size_t chunkSize{1};
+        std::atomic<std::size_t> nextChunk{0};
+        std::size_t activeWorkers{0};
+        std::uint64_t generation{0};
+        bool stopping{false};
+
+        void workerLoop(std::size_t index);
+        void runChunks();
+    };
+} // namespace physx::utils
+
+#endif //PHYSX_THREADPOOL_HPP
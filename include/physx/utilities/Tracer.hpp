@@ -0,0 +1,143 @@
+/**
+ * @file Tracer.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_TRACER_HPP
+#define PHYSX_TRACER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "../math/MathConstants.hpp"
+#include "Arena.hpp"
+#include "Profiler.hpp"
+
+namespace physx::utils {
+    /**
+     * @brief An enumeration of the events a @c Tracer records.
+     */
+    enum class TraceEvent : std::uint8_t {
+        Spawn,              ///< A body was added: @c a is its index, @c detail its shape, @c x and @c y its position.
+        Remove,             ///< A body was removed: @c a is its index.
+        Collision,          ///< Two bodies were found touching: @c a and @c b are their indices.
+        PhaseBegin,         ///< A step phase started: @c detail is the @c ProfilePhase, @c time is set.
+        PhaseEnd,           ///< A step phase ended: @c detail is the @c ProfilePhase, @c time is set.
+        ConstraintClamp     ///< A body was pushed back inside the boundary or out of a collider: @c a is its
+                            ///< index, @c x the overshoot.
+    };
+
+    constexpr std::size_t traceEventCount{6};   ///< The number of @c TraceEvent values.
+
+    /**
+     * @brief One fixed-size trace record. Fields an event does not use are zero.
+     */
+    struct TraceRecord {
+        std::uint64_t time;         ///< Nanoseconds since the tracer was created, phase events only
+        std::uint32_t step;
+        TraceEvent event;
+        std::uint8_t thread;        ///< @c ThreadPool::getThreadIndex of the recording thread
+        std::uint16_t detail;
+        std::uint32_t a;
+        std::uint32_t b;
+        math::f32 x;
+        math::f32 y;
+    };
+
+    /**
+     * @brief @c Tracer class.
+     *
+     * A flight recorder for the simulation step. Each thread appends binary @c TraceRecord values to its own ring
+     * with a plain store and a release increment, so recording takes no locks, does no formatting and never
+     * allocates. Once a ring is full the oldest records are overwritten. Records are only turned into text by
+     * @c dump, which should run between steps, while no thread is recording.
+     *
+     * Instrumentation goes through the @c PHYSX_TRACE macros, which compile to nothing unless @c PHYSX_TRACING is
+     * defined (see the @c PHYSX_ENABLE_TRACING CMake option). Tracing can also be switched off at runtime.
+     * @namespace @c physx::utils
+     */
+    class Tracer {
+    public:
+        /**
+         * @brief Records a @c PhaseBegin on construction and the matching @c PhaseEnd on destruction.
+         */
+        class Scope {
+        public:
+            Scope(Tracer& tracer, ProfilePhase phase)
+                : tracer{tracer}, phase{phase} {
+                tracer.beginPhase(phase);
+            }
+
+            ~Scope() {
+                tracer.endPhase(phase);
+            }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            Tracer& tracer;
+            ProfilePhase phase;
+        };
+
+        explicit Tracer(std::size_t capacity = 1 << 14);
+        ~Tracer() = default;
+
+        Tracer(const Tracer&) = delete;
+        Tracer& operator=(const Tracer&) = delete;
+
+        void setThreadCount(std::size_t threadCount);
+        void setCapacity(std::size_t capacity);
+        void setEnabled(bool enabled);
+        bool isEnabled() const;
+        void setStep(std::uint64_t step);
+        void clear();
+
+        void spawn(std::size_t index, std::uint8_t shape, math::f32 x, math::f32 y);
+        void remove(std::size_t index);
+        void collision(std::size_t a, std::size_t b);
+        void beginPhase(ProfilePhase phase);
+        void endPhase(ProfilePhase phase);
+        void constraintClamp(std::size_t index, math::f32 overshoot);
+
+        std::vector<TraceRecord> collect() const;
+        void dump(std::ostream& out) const;
+
+        static const char* getName(TraceEvent event);
+
+    private:
+        struct alignas(Arena::cacheLineSize) Ring {
+            std::vector<TraceRecord> records;
+            std::atomic<std::uint64_t> head{0};     ///< Records written so far, by the owning thread only
+        };
+
+        std::unique_ptr<Ring[]> rings;
+        std::size_t ringCount{0};
+        std::size_t capacity;                   ///< Records per ring, a power of two
+        bool enabled{true};
+        std::uint32_t step{0};
+        std::chrono::steady_clock::time_point epoch{std::chrono::steady_clock::now()};
+
+        void push(TraceEvent event, std::uint16_t detail, std::uint32_t a, std::uint32_t b, math::f32 x,
+                  math::f32 y, std::uint64_t time = 0);
+        std::uint64_t now() const;
+    };
+} // namespace physx::utils
+
+#if defined(PHYSX_TRACING)
+#define PHYSX_TRACE(call) call
+#define PHYSX_TRACE_SCOPE(tracer, phase) \
+    ::physx::utils::Tracer::Scope PHYSX_PROFILE_JOIN(traceScope, __LINE__){tracer, phase}
+#else
+#define PHYSX_TRACE(call) static_cast<void>(0)
+#define PHYSX_TRACE_SCOPE(tracer, phase) static_cast<void>(0)
+#endif
+
+#endif //PHYSX_TRACER_HPP
@@ -0,0 +1,119 @@
+/**
+ * @file TrajectoryFormat.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_TRAJECTORYFORMAT_HPP
+#define PHYSX_TRAJECTORYFORMAT_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "../math/MathConstants.hpp"
+
+/**
+ * The trajectory stream written by @c TrajectoryRecorder and read by @c TrajectoryReader. Every integer is
+ * little-endian.
+ *
+ * - Header: @c fileMagic, @c u32 version, @c u32 keyframe interval, @c f32 quantum, @c u32 reserved.
+ * - Frames: a @c Chunk tag, then varints for the step number and the body count, then a zigzag varint per body for
+ *   every x and then every y. Positions are quantized to multiples of the quantum. A key frame stores them as they
+ *   are, a delta frame stores the difference from the frame before it (or from zero for bodies it did not have).
+ * - Index: a @c Chunk::Index tag, varints for the frame and key frame counts, then a @c u64 offset per key frame.
+ * - Trailer: the @c u64 offset of the index and @c indexMagic.
+ */
+namespace physx::utils::trajectory {
+    constexpr char fileMagic[8]{'P', 'H', 'Y', 'S', 'X', 'T', 'R', 'J'};
+    constexpr char indexMagic[8]{'P', 'H', 'Y', 'S', 'X', 'I', 'D', 'X'};
+    constexpr std::uint32_t version{1};
+    constexpr std::size_t headerSize{24};
+    constexpr std::size_t trailerSize{16};
+
+    /**
+     * @brief The tag in front of each chunk of a trajectory stream.
+     */
+    enum class Chunk : std::uint8_t {
+        DeltaFrame,
+        KeyFrame,
+        Index
+    };
+
+    inline std::uint64_t zigzag(std::int64_t value) {
+        return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+    }
+
+    inline std::int64_t unzigzag(std::uint64_t value) {
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    /**
+     * @brief Rounds a position to the nearest multiple of the quantum, clamped to the @c int32 range.
+     * @param value
+     *          The position.
+     * @param inverseQuantum
+     *          One over the quantum.
+     * @return The number of quanta, zero for non-finite positions.
+     */
+    inline std::int32_t quantize(math::f32 value, math::f32 inverseQuantum) {
+        const math::f64 scaled{std::round(static_cast<math::f64>(value) * inverseQuantum)};
+        if (!std::isfinite(scaled)) {
+            return 0;
+        }
+        return static_cast<std::int32_t>(std::clamp<math::f64>(scaled, std::numeric_limits<std::int32_t>::min(),
+                                                               std::numeric_limits<std::int32_t>::max()));
+    }
+
+    inline void writeVarint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    /**
+     * @brief Reads a varint, without reading past the end of the data.
+     * @param data
+     *          The first byte of the varint, advanced past it.
+     * @param end
+     *          One past the last readable byte.
+     * @param value
+     *          Receives the value.
+     * @return @c false if the data ends inside the varint or it is too long.
+     */
+    inline bool readVarint(const std::uint8_t*& data, const std::uint8_t* end, std::uint64_t& value) {
+        value = 0;
+        for (unsigned shift{0}; shift < 64 && data < end; shift += 7) {
+            const std::uint8_t byte{*data++};
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<typename T>
+    void writeLittleEndian(std::vector<std::uint8_t>& out, T value) {
+        for (std::size_t i{0}; i < sizeof(T); ++i) {
+            out.push_back(static_cast<std::uint8_t>(static_cast<std::uint64_t>(value) >> (8 * i)));
+        }
+    }
+
+    template<typename T>
+    T readLittleEndian(const std::uint8_t* data) {
+        std::uint64_t value{0};
+        for (std::size_t i{0}; i < sizeof(T); ++i) {
+            value |= static_cast<std::uint64_t>(data[i]) << (8 * i);
+        }
+        return static_cast<T>(value);
+    }
+} // namespace physx::utils::trajectory
+
+#endif //PHYSX_TRAJECTORYFORMAT_HPP
@@ -0,0 +1,64 @@
+/**
+ * @file TrajectoryReader.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_TRAJECTORYREADER_HPP
+#define PHYSX_TRAJECTORYREADER_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../exceptions/TrajectoryException.hpp"
+#include "../math/MathConstants.hpp"
+#include "MappedFile.hpp"
+
+namespace physx::utils {
+    /**
+     * @brief @c TrajectoryReader class.
+     *
+     * Reads back a trajectory file written by @c TrajectoryRecorder. The file is memory-mapped, and the key frame
+     * index lets @c seek jump to any frame by decoding at most one key frame interval.
+     * @namespace @c physx::utils
+     */
+    class TrajectoryReader {
+    public:
+        explicit TrajectoryReader(const std::string& path);
+        ~TrajectoryReader() = default;
+
+        TrajectoryReader(const TrajectoryReader&) = delete;
+        TrajectoryReader& operator=(const TrajectoryReader&) = delete;
+
+        void seek(std::size_t frame);
+        bool next(std::vector<math::f32>& x, std::vector<math::f32>& y);
+
+        std::size_t getFrameCount() const;
+        std::size_t getKeyframeInterval() const;
+        math::f32 getQuantum() const;
+        std::uint64_t getStep() const;
+
+    private:
+        std::string path;
+        MappedFile file;
+        const std::uint8_t* data{nullptr};      ///< The start of the file
+        const std::uint8_t* framesEnd{nullptr}; ///< The index, after the last frame
+        math::f32 quantum;
+        std::size_t keyframeInterval;
+        std::size_t frameCount;
+        std::vector<std::uint64_t> keyframeOffsets;
+
+        const std::uint8_t* position{nullptr};  ///< The next frame to decode
+        std::size_t frame{0};                   ///< The index of the next frame to decode
+        std::uint64_t step{0};                  ///< The step of the last decoded frame
+        std::vector<std::int32_t> currentX;     ///< Quantized positions of the last decoded frame
+        std::vector<std::int32_t> currentY;
+
+        void decodeFrame();
+        [[noreturn]] void fail(const std::string& reason) const;
+    };
+} // namespace physx::utils
+
+#endif //PHYSX_TRAJECTORYREADER_HPP
@@ -0,0 +1,81 @@
+/**
+ * @file TrajectoryRecorder.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_TRAJECTORYRECORDER_HPP
+#define PHYSX_TRAJECTORYRECORDER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../exceptions/TrajectoryException.hpp"
+#include "../math/MathConstants.hpp"
+#include "SpscRing.hpp"
+
+namespace physx::utils {
+    /**
+     * @brief @c TrajectoryRecorder class.
+     *
+     * Records the position of every body once per step to a trajectory file, see @c TrajectoryFormat.hpp. The
+     * stepping thread only copies the positions into a free slot of a lock-free ring. A writer thread quantizes and
+     * delta-encodes them and writes them out, so disk speed never stalls the simulation. When the writer falls
+     * behind and the ring is full, frames are dropped and counted instead.
+     * @namespace @c physx::utils
+     */
+    class TrajectoryRecorder {
+    public:
+        TrajectoryRecorder(const std::string& path, math::f32 quantum = 1.f / 256.f,
+                           std::size_t keyframeInterval = 60, std::size_t ringCapacity = 64);
+        ~TrajectoryRecorder();
+
+        TrajectoryRecorder(const TrajectoryRecorder&) = delete;
+        TrajectoryRecorder& operator=(const TrajectoryRecorder&) = delete;
+
+        bool record(const math::f32* x, const math::f32* y, std::size_t count);
+        void close();
+
+        std::uint64_t getStepCount() const;
+        std::uint64_t getDroppedCount() const;
+
+    private:
+        struct Frame {
+            std::uint64_t step;
+            std::vector<math::f32> x;
+            std::vector<math::f32> y;
+        };
+
+        std::string path;
+        std::ofstream file;
+        math::f32 inverseQuantum;
+        std::size_t keyframeInterval;
+        SpscRing<Frame> ring;
+        std::uint64_t stepCount{0};                 ///< Steps passed to @c record, written by the stepping thread
+        std::atomic<std::uint64_t> droppedCount{0};
+        std::atomic<bool> stopping{false};
+        bool closed{false};
+
+        // Owned by the writer thread until it is joined.
+        std::uint64_t frameCount{0};
+        std::uint64_t offset{0};                    ///< Bytes written so far
+        std::vector<std::uint64_t> keyframeOffsets;
+        std::vector<std::int32_t> previousX;        ///< Quantized positions of the last written frame
+        std::vector<std::int32_t> previousY;
+        std::vector<std::uint8_t> buffer;
+
+        std::thread writer;
+
+        void writerLoop();
+        void writeFrame(const Frame& frame);
+        void writeIndex();
+        void flush();
+    };
+} // namespace physx::utils
+
+#endif //PHYSX_TRAJECTORYRECORDER_HPP
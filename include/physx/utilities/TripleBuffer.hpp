@@ -0,0 +1,85 @@
+/**
+ * @file TripleBuffer.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_TRIPLEBUFFER_HPP
+#define PHYSX_TRIPLEBUFFER_HPP
+
+#include <atomic>
+#include <cstdint>
+
+#include "Arena.hpp"
+
+namespace physx::utils {
+    /**
+     * @brief @c TripleBuffer class.
+     *
+     * Hands the latest value from exactly one writer thread to exactly one reader thread without locking either.
+     * The writer fills its back slot and publishes it, swapping it with the shared middle slot; the reader swaps the
+     * middle slot with its front slot whenever something new was published. Neither side ever waits for the other,
+     * the reader always sees a complete value and values published between two reads are simply skipped.
+     *
+     * Slots are reused in place, so values that own memory (such as vectors) keep their capacity.
+     * @tparam T
+     *          The slot type.
+     * @namespace @c physx::utils
+     */
+    template<typename T>
+    class TripleBuffer {
+    public:
+        TripleBuffer() = default;
+        ~TripleBuffer() = default;
+
+        TripleBuffer(const TripleBuffer&) = delete;
+        TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+        /**
+         * @brief Gets the slot the writer fills next.
+         * @return The back slot.
+         */
+        T& getWriteBuffer() {
+            return slots[back];
+        }
+
+        /**
+         * @brief Hands the back slot to the reader, taking the previous middle slot as the new back slot.
+         */
+        void publish() {
+            back = middle.exchange(back | fresh, std::memory_order_acq_rel) & indexMask;
+        }
+
+        /**
+         * @brief Checks whether the last published value has not been picked up by the reader yet. Lets the writer
+         * skip filling values the reader would never see.
+         * @return True if a published value is waiting.
+         */
+        bool isPending() const {
+            return (middle.load(std::memory_order_acquire) & fresh) != 0;
+        }
+
+        /**
+         * @brief Gets the newest published value, or the previous one if nothing was published since the last call.
+         * @return The front slot, valid until the next call to @c read.
+         */
+        const T& read() {
+            if ((middle.load(std::memory_order_relaxed) & fresh) != 0) {
+                front = middle.exchange(front, std::memory_order_acq_rel) & indexMask;
+            }
+            return slots[front];
+        }
+
+    private:
+        static constexpr std::uint8_t indexMask{0x03};
+        static constexpr std::uint8_t fresh{0x04};   ///< Set on the middle index while it holds an unread value
+
+        T slots[3]{};
+        alignas(Arena::cacheLineSize) std::atomic<std::uint8_t> middle{1};  ///< Shared slot index and @c fresh bit
+        alignas(Arena::cacheLineSize) std::uint8_t back{0};                 ///< Owned by the writer
+        alignas(Arena::cacheLineSize) std::uint8_t front{2};                ///< Owned by the reader
+    };
+} // namespace physx::utils
+
+#endif //PHYSX_TRIPLEBUFFER_HPP
@@ -0,0 +1,40 @@
+/**
+ * @file Vec2Batch.hpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#ifndef PHYSX_VEC2BATCH_HPP
+#define PHYSX_VEC2BATCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../dynamic/Integrators.hpp"
+#include "../math/MathConstants.hpp"
+
+/**
+ * Batch versions of the @c Vec2Utils operations that run over separate, contiguous x and y arrays.
+ *
+ * Each kernel uses AVX2 when the translation unit is built with it (see @c PHYSX_ENABLE_AVX2), SSE2 on any other
+ * x86-64 build and a scalar loop everywhere else. All paths compute the same expressions in the same order, and
+ * none of them branch per element or throw on a zero divisor.
+ */
+namespace physx::utils::batch {
+    const char* getInstructionSet();
+
+    // Instantiated in Vec2Batch.cpp for each policy in Integrators.hpp.
+    template<typename Integrator>
+    void integrate(math::f32* x, math::f32* y, math::f32* oldX, math::f32* oldY, math::f32* velX, math::f32* velY,
+                   math::f32* accX, math::f32* accY, const std::uint8_t* groups, std::size_t count, math::f32 dt);
+    void accelerate(math::f32* accX, math::f32* accY, const std::uint8_t* enabled, std::size_t count,
+                    math::f32 ax, math::f32 ay);
+    void constrainToCircle(math::f32* x, math::f32* y, const math::f32* extent, std::size_t count,
+                           math::f32 centerX, math::f32 centerY, math::f32 radius);
+    void length(const math::f32* x, const math::f32* y, math::f32* out, std::size_t count);
+    void distance(const math::f32* ax, const math::f32* ay, const math::f32* bx, const math::f32* by,
+                  math::f32* out, std::size_t count);
+} // namespace physx::utils::batch
+
+#endif //PHYSX_VEC2BATCH_HPP
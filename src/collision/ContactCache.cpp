@@ -0,0 +1,137 @@
+/**
+ * @file ContactCache.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/collision/ContactCache.hpp"
+
+#include <algorithm>
+
+namespace physx::collision {
+    /**
+     * @brief Sets the impulses of each contact to those cached for its pair, or to zero for new pairs.
+     *
+     * The impulses keep their meaning when the pair comes back with its bodies swapped, since the normal and the
+     * tangent are then both reversed.
+     * @param contacts
+     *          The contacts of this step.
+     */
+    void ContactCache::warmStart(std::vector<Contact>& contacts) const {
+        for (auto& contact : contacts) {
+            contact.normalImpulse = 0.f;
+            contact.tangentImpulse = 0.f;
+            if (count == 0) {
+                continue;
+            }
+
+            const Entry& entry{slots[findSlot(getKey(contact.a, contact.b))]};
+            if (entry.key == emptyKey || isRemoved(entry.key)) {
+                continue;
+            }
+
+            const math::f32 orientation{contact.a < contact.b ? 1.f : -1.f};
+            const math::f32 alignment{orientation * (contact.normalX * entry.normalX +
+                                                     contact.normalY * entry.normalY)};
+            if (alignment >= minNormalAlignment) {
+                contact.normalImpulse = entry.normalImpulse;
+                contact.tangentImpulse = entry.tangentImpulse;
+            }
+        }
+    }
+
+    /**
+     * @brief Replaces the cache with the impulses the solver left on the contacts of this step.
+     * @param contacts
+     *          The solved contacts, at most one per pair.
+     */
+    void ContactCache::store(const std::vector<Contact>& contacts) {
+        std::size_t capacity{16};
+        while (capacity < contacts.size() * 2) {
+            capacity <<= 1;
+        }
+        slots.assign(capacity, Entry{emptyKey, 0.f, 0.f, 0.f, 0.f});
+        count = contacts.size();
+        removedBodies.clear();
+
+        for (const auto& contact : contacts) {
+            const std::uint64_t key{getKey(contact.a, contact.b)};
+            const math::f32 orientation{contact.a < contact.b ? 1.f : -1.f};
+            slots[findSlot(key)] = {key, orientation * contact.normalX, orientation * contact.normalY,
+                                    contact.normalImpulse, contact.tangentImpulse};
+        }
+    }
+
+    /**
+     * @brief Drops the cached impulses of every pair holding a body, for when its index is freed and may be reused.
+     *
+     * The pairs stay in the table but are never warm started from, and the next @c store leaves them out.
+     * @param body
+     *          The index of the removed body.
+     */
+    void ContactCache::removeBody(std::uint32_t body) {
+        const auto it{std::lower_bound(removedBodies.begin(), removedBodies.end(), body)};
+        if (it == removedBodies.end() || *it != body) {
+            removedBodies.insert(it, body);
+        }
+    }
+
+    /**
+     * @brief Drops every cached impulse, for when body indices stop meaning the same bodies.
+     */
+    void ContactCache::clear() {
+        slots.clear();
+        count = 0;
+        removedBodies.clear();
+    }
+
+    /**
+     * @brief Gets the number of cached pairs.
+     * @return The pair count.
+     */
+    std::size_t ContactCache::size() const {
+        return count;
+    }
+
+    /**
+     * @brief Gets the key of a pair of bodies, the same whichever order they are given in.
+     * @param a
+     *          The index of one body.
+     * @param b
+     *          The index of the other body.
+     * @return The key.
+     */
+    std::uint64_t ContactCache::getKey(std::uint32_t a, std::uint32_t b) {
+        return (static_cast<std::uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+    }
+
+    /**
+     * @brief Checks whether either body of a cached pair was removed since the last @c store.
+     * @param key
+     *          The key of the pair.
+     * @return True if the pair holds a removed body, false otherwise.
+     */
+    bool ContactCache::isRemoved(std::uint64_t key) const {
+        if (removedBodies.empty()) {
+            return false;
+        }
+        return std::binary_search(removedBodies.begin(), removedBodies.end(), static_cast<std::uint32_t>(key >> 32)) ||
+               std::binary_search(removedBodies.begin(), removedBodies.end(), static_cast<std::uint32_t>(key));
+    }
+
+    /**
+     * @brief Finds the slot holding a key, or the empty slot it would go in, by linear probing.
+     * @param key
+     *          The key.
+     * @return The slot index.
+     */
+    std::size_t ContactCache::findSlot(std::uint64_t key) const {
+        const std::size_t mask{slots.size() - 1};
+        std::size_t slot{static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask};
+        while (slots[slot].key != key && slots[slot].key != emptyKey) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+} // namespace physx::collision
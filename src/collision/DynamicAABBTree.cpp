@@ -0,0 +1,320 @@
+/**
+ * @file DynamicAABBTree.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/collision/DynamicAABBTree.hpp"
+
+namespace physx::collision {
+    /**
+     * @brief @c DynamicAABBTree constructor.
+     * @param margin
+     *          How far each fat box extends past the bounds of its body.
+     */
+    DynamicAABBTree::DynamicAABBTree(math::f32 margin)
+        : margin{margin} {
+    }
+
+    /**
+     * @brief Brings the tree up to date with the bounds of every body.
+     *
+     * Bodies without a leaf get one, bodies with an empty box lose theirs and bodies that escaped their fat box are
+     * reinserted. Everything else is left alone.
+     * @param boxes
+     *          The bounds of each body, empty for bodies that should not be in the tree.
+     * @param count
+     *          The number of bodies.
+     */
+    void DynamicAABBTree::update(const AABB* boxes, std::size_t count) {
+        for (std::size_t i{count}; i < bodyLeaves.size(); ++i) {
+            if (bodyLeaves[i] != nullNode) {
+                removeLeaf(bodyLeaves[i]);
+                freeNode(bodyLeaves[i]);
+            }
+        }
+        bodyLeaves.resize(count, nullNode);
+        reinsertCount = 0;
+
+        for (std::size_t i{0}; i < count; ++i) {
+            math::i32 leaf{bodyLeaves[i]};
+
+            if (boxes[i].isEmpty()) {
+                if (leaf != nullNode) {
+                    removeLeaf(leaf);
+                    freeNode(leaf);
+                    bodyLeaves[i] = nullNode;
+                }
+                continue;
+            }
+
+            if (leaf == nullNode) {
+                leaf = allocateNode();
+                nodes[leaf].body = static_cast<std::uint32_t>(i);
+                bodyLeaves[i] = leaf;
+            } else if (nodes[leaf].box.contains(boxes[i])) {
+                continue;
+            } else {
+                removeLeaf(leaf);
+                ++reinsertCount;
+            }
+
+            nodes[leaf].box = boxes[i].expanded(margin);
+            insertLeaf(leaf);
+        }
+    }
+
+    /**
+     * @brief Finds every pair of bodies whose fat boxes overlap.
+     *
+     * Pairs are reported once, with the lower body index first, in order of the first body.
+     * @param pairs
+     *          Receives the pairs.
+     */
+    void DynamicAABBTree::findPairs(std::vector<CollisionPair>& pairs) const {
+        for (std::size_t i{0}; i < bodyLeaves.size(); ++i) {
+            if (bodyLeaves[i] == nullNode) {
+                continue;
+            }
+
+            const auto body{static_cast<std::uint32_t>(i)};
+            query(nodes[bodyLeaves[i]].box, [body, &pairs](std::uint32_t other) {
+                if (body < other) {
+                    pairs.push_back({body, other});
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Removes every leaf from the tree.
+     */
+    void DynamicAABBTree::clear() {
+        nodes.clear();
+        bodyLeaves.clear();
+        root = nullNode;
+        freeList = nullNode;
+    }
+
+    /**
+     * @brief Sets how far fat boxes extend past the bounds of their body. Applies to leaves inserted from now on.
+     * @param newMargin
+     *          The new margin.
+     */
+    void DynamicAABBTree::setMargin(math::f32 newMargin) {
+        margin = newMargin;
+    }
+
+    math::f32 DynamicAABBTree::getMargin() const {
+        return margin;
+    }
+
+    /**
+     * @brief Gets the height of the tree, zero when it holds a single leaf.
+     * @return The height.
+     */
+    math::i32 DynamicAABBTree::getHeight() const {
+        return root == nullNode ? 0 : nodes[root].height;
+    }
+
+    /**
+     * @brief Gets the number of leaves the last @c update reinserted because their body escaped its fat box.
+     * @return The reinsert count.
+     */
+    std::size_t DynamicAABBTree::getReinsertCount() const {
+        return reinsertCount;
+    }
+
+    math::i32 DynamicAABBTree::allocateNode() {
+        math::i32 node;
+        if (freeList == nullNode) {
+            node = static_cast<math::i32>(nodes.size());
+            nodes.emplace_back();
+        } else {
+            node = freeList;
+            freeList = nodes[node].parent;
+        }
+
+        nodes[node].parent = nullNode;
+        nodes[node].child1 = nullNode;
+        nodes[node].child2 = nullNode;
+        nodes[node].height = 0;
+        nodes[node].body = 0;
+        return node;
+    }
+
+    void DynamicAABBTree::freeNode(math::i32 node) {
+        nodes[node].parent = freeList;
+        nodes[node].height = -1;
+        freeList = node;
+    }
+
+    /**
+     * @brief Inserts a leaf next to the sibling that grows the tree's total perimeter the least.
+     * @param leaf
+     *          The leaf, with its fat box set.
+     */
+    void DynamicAABBTree::insertLeaf(math::i32 leaf) {
+        if (root == nullNode) {
+            root = leaf;
+            nodes[root].parent = nullNode;
+            return;
+        }
+
+        const AABB leafBox{nodes[leaf].box};
+        math::i32 index{root};
+        while (!nodes[index].isLeaf()) {
+            const math::i32 child1{nodes[index].child1};
+            const math::i32 child2{nodes[index].child2};
+
+            const math::f32 perimeter{nodes[index].box.perimeter()};
+            const math::f32 combinedPerimeter{nodes[index].box.merged(leafBox).perimeter()};
+
+            // Cost of making a new parent for this node and the leaf, and the cost pushed down to either child.
+            const math::f32 cost{2.f * combinedPerimeter};
+            const math::f32 inheritanceCost{2.f * (combinedPerimeter - perimeter)};
+
+            auto descendCost = [&](math::i32 child) {
+                const math::f32 merged{nodes[child].box.merged(leafBox).perimeter()};
+                return (nodes[child].isLeaf() ? merged : merged - nodes[child].box.perimeter()) + inheritanceCost;
+            };
+            const math::f32 cost1{descendCost(child1)};
+            const math::f32 cost2{descendCost(child2)};
+
+            if (cost < cost1 && cost < cost2) {
+                break;
+            }
+            index = cost1 < cost2 ? child1 : child2;
+        }
+
+        const math::i32 sibling{index};
+        const math::i32 oldParent{nodes[sibling].parent};
+        const math::i32 newParent{allocateNode()};
+        nodes[newParent].parent = oldParent;
+        nodes[newParent].box = leafBox.merged(nodes[sibling].box);
+        nodes[newParent].height = nodes[sibling].height + 1;
+        nodes[newParent].child1 = sibling;
+        nodes[newParent].child2 = leaf;
+        nodes[sibling].parent = newParent;
+        nodes[leaf].parent = newParent;
+
+        if (oldParent == nullNode) {
+            root = newParent;
+        } else if (nodes[oldParent].child1 == sibling) {
+            nodes[oldParent].child1 = newParent;
+        } else {
+            nodes[oldParent].child2 = newParent;
+        }
+
+        refit(nodes[leaf].parent);
+    }
+
+    /**
+     * @brief Removes a leaf, replacing its parent with its sibling. The leaf node itself is not freed.
+     * @param leaf
+     *          The leaf.
+     */
+    void DynamicAABBTree::removeLeaf(math::i32 leaf) {
+        if (leaf == root) {
+            root = nullNode;
+            return;
+        }
+
+        const math::i32 parent{nodes[leaf].parent};
+        const math::i32 grandParent{nodes[parent].parent};
+        const math::i32 sibling{nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1};
+
+        if (grandParent == nullNode) {
+            root = sibling;
+            nodes[sibling].parent = nullNode;
+            freeNode(parent);
+            return;
+        }
+
+        if (nodes[grandParent].child1 == parent) {
+            nodes[grandParent].child1 = sibling;
+        } else {
+            nodes[grandParent].child2 = sibling;
+        }
+        nodes[sibling].parent = grandParent;
+        freeNode(parent);
+
+        refit(grandParent);
+    }
+
+    /**
+     * @brief Walks from a node up to the root, rebalancing and recomputing the heights and boxes on the way.
+     * @param node
+     *          The first node to fix.
+     */
+    void DynamicAABBTree::refit(math::i32 node) {
+        while (node != nullNode) {
+            node = balance(node);
+
+            const math::i32 child1{nodes[node].child1};
+            const math::i32 child2{nodes[node].child2};
+            nodes[node].height = 1 + std::max(nodes[child1].height, nodes[child2].height);
+            nodes[node].box = nodes[child1].box.merged(nodes[child2].box);
+
+            node = nodes[node].parent;
+        }
+    }
+
+    /**
+     * @brief Rotates the taller child of a node up when the heights of its children differ by more than one.
+     * @param a
+     *          The node.
+     * @return The node now at the position of @p a.
+     */
+    math::i32 DynamicAABBTree::balance(math::i32 a) {
+        if (nodes[a].isLeaf() || nodes[a].height < 2) {
+            return a;
+        }
+
+        const math::i32 b{nodes[a].child1};
+        const math::i32 c{nodes[a].child2};
+        const math::i32 difference{nodes[c].height - nodes[b].height};
+        if (difference >= -1 && difference <= 1) {
+            return a;
+        }
+
+        // The taller child (up) replaces a. a keeps its other child (keep) and takes the shorter grandchild.
+        const bool rotateC{difference > 1};
+        const math::i32 up{rotateC ? c : b};
+        const math::i32 keep{rotateC ? b : c};
+        const math::i32 f{nodes[up].child1};
+        const math::i32 g{nodes[up].child2};
+
+        nodes[up].child1 = a;
+        nodes[up].parent = nodes[a].parent;
+        nodes[a].parent = up;
+
+        if (nodes[up].parent == nullNode) {
+            root = up;
+        } else if (nodes[nodes[up].parent].child1 == a) {
+            nodes[nodes[up].parent].child1 = up;
+        } else {
+            nodes[nodes[up].parent].child2 = up;
+        }
+
+        const bool fTaller{nodes[f].height > nodes[g].height};
+        const math::i32 taller{fTaller ? f : g};
+        const math::i32 shorter{fTaller ? g : f};
+
+        nodes[up].child2 = taller;
+        if (rotateC) {
+            nodes[a].child2 = shorter;
+        } else {
+            nodes[a].child1 = shorter;
+        }
+        nodes[shorter].parent = a;
+
+        nodes[a].box = nodes[keep].box.merged(nodes[shorter].box);
+        nodes[a].height = 1 + std::max(nodes[keep].height, nodes[shorter].height);
+        nodes[up].box = nodes[a].box.merged(nodes[taller].box);
+        nodes[up].height = 1 + std::max(nodes[a].height, nodes[taller].height);
+
+        return up;
+    }
+} // namespace physx::collision
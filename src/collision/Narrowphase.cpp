@@ -0,0 +1,316 @@
+/**
+ * @file Narrowphase.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/collision/Narrowphase.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace physx::collision {
+    namespace {
+        math::f32 signOf(math::f32 value) {
+            return value < 0.f ? -1.f : 1.f;
+        }
+    } // namespace
+
+    /**
+     * @brief Tests two circles.
+     *
+     * Circles with the same center are pushed apart along the x-axis.
+     * @param ax
+     *          The x-component of the center of the first circle.
+     * @param ay
+     *          The y-component of the center of the first circle.
+     * @param aRadius
+     *          The radius of the first circle.
+     * @param bx
+     *          The x-component of the center of the second circle.
+     * @param by
+     *          The y-component of the center of the second circle.
+     * @param bRadius
+     *          The radius of the second circle.
+     * @param contact
+     *          Receives the contact, with one point halfway through the overlap.
+     * @return True if the circles overlap.
+     */
+    bool collideCircles(math::f32 ax, math::f32 ay, math::f32 aRadius, math::f32 bx, math::f32 by,
+                        math::f32 bRadius, Contact& contact) {
+        const math::f32 dx{bx - ax};
+        const math::f32 dy{by - ay};
+        const math::f32 radii{aRadius + bRadius};
+        const math::f32 distanceSquared{dx * dx + dy * dy};
+        if (distanceSquared >= radii * radii) {
+            return false;
+        }
+
+        const math::f32 distance{std::sqrt(distanceSquared)};
+        contact.normalX = distance > 0.f ? dx / distance : 1.f;
+        contact.normalY = distance > 0.f ? dy / distance : 0.f;
+        contact.depth = radii - distance;
+        contact.pointCount = 1;
+        contact.pointX[0] = ax + contact.normalX * (aRadius - contact.depth / 2.f);
+        contact.pointY[0] = ay + contact.normalY * (aRadius - contact.depth / 2.f);
+        return true;
+    }
+
+    /**
+     * @brief Tests a circle against a box.
+     *
+     * A circle whose center is outside the box touches it at the closest point of the box. A circle whose center
+     * is inside is pushed out through the nearest face.
+     * @param cx
+     *          The x-component of the center of the circle.
+     * @param cy
+     *          The y-component of the center of the circle.
+     * @param radius
+     *          The radius of the circle.
+     * @param bx
+     *          The x-component of the center of the box.
+     * @param by
+     *          The y-component of the center of the box.
+     * @param halfWidth
+     *          Half the width of the box.
+     * @param halfHeight
+     *          Half the height of the box.
+     * @param contact
+     *          Receives the contact, with one point on the surface of the box.
+     * @return True if the shapes overlap.
+     */
+    bool collideCircleBox(math::f32 cx, math::f32 cy, math::f32 radius, math::f32 bx, math::f32 by,
+                          math::f32 halfWidth, math::f32 halfHeight, Contact& contact) {
+        const math::f32 dx{cx - bx};
+        const math::f32 dy{cy - by};
+        const math::f32 closestX{std::clamp(dx, -halfWidth, halfWidth)};
+        const math::f32 closestY{std::clamp(dy, -halfHeight, halfHeight)};
+
+        if (closestX != dx || closestY != dy) {
+            const math::f32 ex{dx - closestX};
+            const math::f32 ey{dy - closestY};
+            const math::f32 distanceSquared{ex * ex + ey * ey};
+            if (distanceSquared >= radius * radius) {
+                return false;
+            }
+
+            const math::f32 distance{std::sqrt(distanceSquared)};
+            contact.normalX = -ex / distance;
+            contact.normalY = -ey / distance;
+            contact.depth = radius - distance;
+            contact.pointCount = 1;
+            contact.pointX[0] = bx + closestX;
+            contact.pointY[0] = by + closestY;
+            return true;
+        }
+
+        const math::f32 gapX{halfWidth - std::abs(dx)};
+        const math::f32 gapY{halfHeight - std::abs(dy)};
+        contact.pointCount = 1;
+        if (gapX < gapY) {
+            contact.normalX = -signOf(dx);
+            contact.normalY = 0.f;
+            contact.depth = radius + gapX;
+            contact.pointX[0] = bx + signOf(dx) * halfWidth;
+            contact.pointY[0] = cy;
+        } else {
+            contact.normalX = 0.f;
+            contact.normalY = -signOf(dy);
+            contact.depth = radius + gapY;
+            contact.pointX[0] = cx;
+            contact.pointY[0] = by + signOf(dy) * halfHeight;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Tests two boxes with the separating axis theorem.
+     *
+     * The boxes overlap unless they are separated along the x- or y-axis. The contact normal is the axis of least
+     * overlap, and the points are the ends of the overlapping part of the face of the second box.
+     * @param ax
+     *          The x-component of the center of the first box.
+     * @param ay
+     *          The y-component of the center of the first box.
+     * @param aHalfWidth
+     *          Half the width of the first box.
+     * @param aHalfHeight
+     *          Half the height of the first box.
+     * @param bx
+     *          The x-component of the center of the second box.
+     * @param by
+     *          The y-component of the center of the second box.
+     * @param bHalfWidth
+     *          Half the width of the second box.
+     * @param bHalfHeight
+     *          Half the height of the second box.
+     * @param contact
+     *          Receives the contact, with one or two points.
+     * @return True if the boxes overlap.
+     */
+    bool collideBoxes(math::f32 ax, math::f32 ay, math::f32 aHalfWidth, math::f32 aHalfHeight, math::f32 bx,
+                      math::f32 by, math::f32 bHalfWidth, math::f32 bHalfHeight, Contact& contact) {
+        const math::f32 dx{bx - ax};
+        const math::f32 dy{by - ay};
+        const math::f32 overlapX{aHalfWidth + bHalfWidth - std::abs(dx)};
+        const math::f32 overlapY{aHalfHeight + bHalfHeight - std::abs(dy)};
+        if (overlapX <= 0.f || overlapY <= 0.f) {
+            return false;
+        }
+
+        if (overlapX < overlapY) {
+            const math::f32 faceX{bx - signOf(dx) * bHalfWidth};
+            contact.normalX = signOf(dx);
+            contact.normalY = 0.f;
+            contact.depth = overlapX;
+            contact.pointX[0] = faceX;
+            contact.pointY[0] = std::max(ay - aHalfHeight, by - bHalfHeight);
+            contact.pointX[1] = faceX;
+            contact.pointY[1] = std::min(ay + aHalfHeight, by + bHalfHeight);
+        } else {
+            const math::f32 faceY{by - signOf(dy) * bHalfHeight};
+            contact.normalX = 0.f;
+            contact.normalY = signOf(dy);
+            contact.depth = overlapY;
+            contact.pointX[0] = std::max(ax - aHalfWidth, bx - bHalfWidth);
+            contact.pointY[0] = faceY;
+            contact.pointX[1] = std::min(ax + aHalfWidth, bx + bHalfWidth);
+            contact.pointY[1] = faceY;
+        }
+        contact.pointCount = contact.pointX[0] == contact.pointX[1] && contact.pointY[0] == contact.pointY[1] ? 1 : 2;
+        return true;
+    }
+
+    /**
+     * @brief Tests a circle against a segment.
+     *
+     * A circle whose center lies on the segment is pushed out along the normal of the segment.
+     * @param cx
+     *          The x-component of the center of the circle.
+     * @param cy
+     *          The y-component of the center of the circle.
+     * @param radius
+     *          The radius of the circle.
+     * @param x0
+     *          The x-component of the start of the segment.
+     * @param y0
+     *          The y-component of the start of the segment.
+     * @param x1
+     *          The x-component of the end of the segment.
+     * @param y1
+     *          The y-component of the end of the segment.
+     * @param contact
+     *          Receives the contact, with one point at the closest point of the segment.
+     * @return True if the shapes overlap.
+     */
+    bool collideCircleSegment(math::f32 cx, math::f32 cy, math::f32 radius, math::f32 x0, math::f32 y0,
+                              math::f32 x1, math::f32 y1, Contact& contact) {
+        const math::f32 ex{x1 - x0};
+        const math::f32 ey{y1 - y0};
+        const math::f32 lengthSquared{ex * ex + ey * ey};
+        const math::f32 t{lengthSquared > 0.f
+                          ? std::clamp(((cx - x0) * ex + (cy - y0) * ey) / lengthSquared, 0.f, 1.f) : 0.f};
+        const math::f32 closestX{x0 + ex * t};
+        const math::f32 closestY{y0 + ey * t};
+        const math::f32 dx{closestX - cx};
+        const math::f32 dy{closestY - cy};
+        const math::f32 distanceSquared{dx * dx + dy * dy};
+        if (distanceSquared >= radius * radius) {
+            return false;
+        }
+
+        const math::f32 distance{std::sqrt(distanceSquared)};
+        if (distance > 0.f) {
+            contact.normalX = dx / distance;
+            contact.normalY = dy / distance;
+        } else if (lengthSquared > 0.f) {
+            const math::f32 length{std::sqrt(lengthSquared)};
+            contact.normalX = -ey / length;
+            contact.normalY = ex / length;
+        } else {
+            contact.normalX = 0.f;
+            contact.normalY = 1.f;
+        }
+        contact.depth = radius - distance;
+        contact.pointCount = 1;
+        contact.pointX[0] = closestX;
+        contact.pointY[0] = closestY;
+        return true;
+    }
+
+    /**
+     * @brief Tests a box against a segment with the separating axis theorem.
+     *
+     * The shapes overlap unless they are separated along the x-axis, the y-axis or the normal of the segment. The
+     * contact normal is the axis of least overlap.
+     * @param bx
+     *          The x-component of the center of the box.
+     * @param by
+     *          The y-component of the center of the box.
+     * @param halfWidth
+     *          Half the width of the box.
+     * @param halfHeight
+     *          Half the height of the box.
+     * @param x0
+     *          The x-component of the start of the segment.
+     * @param y0
+     *          The y-component of the start of the segment.
+     * @param x1
+     *          The x-component of the end of the segment.
+     * @param y1
+     *          The y-component of the end of the segment.
+     * @param contact
+     *          Receives the contact, with one point at the point of the segment closest to the center of the box.
+     * @return True if the shapes overlap.
+     */
+    bool collideBoxSegment(math::f32 bx, math::f32 by, math::f32 halfWidth, math::f32 halfHeight, math::f32 x0,
+                           math::f32 y0, math::f32 x1, math::f32 y1, Contact& contact) {
+        const math::f32 midX{(x0 + x1) / 2.f};
+        const math::f32 midY{(y0 + y1) / 2.f};
+        const math::f32 overlapX{halfWidth + std::abs(x1 - x0) / 2.f - std::abs(midX - bx)};
+        const math::f32 overlapY{halfHeight + std::abs(y1 - y0) / 2.f - std::abs(midY - by)};
+        if (overlapX <= 0.f || overlapY <= 0.f) {
+            return false;
+        }
+
+        const math::f32 ex{x1 - x0};
+        const math::f32 ey{y1 - y0};
+        const math::f32 length{std::sqrt(ex * ex + ey * ey)};
+        math::f32 overlapNormal{overlapX + overlapY};
+        math::f32 normalX{0.f};
+        math::f32 normalY{0.f};
+        if (length > 0.f) {
+            normalX = -ey / length;
+            normalY = ex / length;
+            const math::f32 separation{normalX * (midX - bx) + normalY * (midY - by)};
+            overlapNormal = halfWidth * std::abs(normalX) + halfHeight * std::abs(normalY) - std::abs(separation);
+            if (overlapNormal <= 0.f) {
+                return false;
+            }
+            normalX *= signOf(separation);
+            normalY *= signOf(separation);
+        }
+
+        if (overlapNormal < overlapX && overlapNormal < overlapY) {
+            contact.normalX = normalX;
+            contact.normalY = normalY;
+            contact.depth = overlapNormal;
+        } else if (overlapX < overlapY) {
+            contact.normalX = signOf(midX - bx);
+            contact.normalY = 0.f;
+            contact.depth = overlapX;
+        } else {
+            contact.normalX = 0.f;
+            contact.normalY = signOf(midY - by);
+            contact.depth = overlapY;
+        }
+
+        const math::f32 t{length > 0.f
+                          ? std::clamp(((bx - x0) * ex + (by - y0) * ey) / (length * length), 0.f, 1.f) : 0.f};
+        contact.pointCount = 1;
+        contact.pointX[0] = x0 + ex * t;
+        contact.pointY[0] = y0 + ey * t;
+        return true;
+    }
+} // namespace physx::collision
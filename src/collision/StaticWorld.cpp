@@ -0,0 +1,224 @@
+/**
+ * @file StaticWorld.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/collision/StaticWorld.hpp"
+
+#include <algorithm>
+
+namespace physx::collision {
+    /**
+     * @brief Gets the box around the shape.
+     * @return The bounds.
+     */
+    AABB StaticShape::getBounds() const {
+        switch (type) {
+            case StaticShapeType::Segment:
+                return {std::min(x, endX), std::min(y, endY), std::max(x, endX), std::max(y, endY)};
+            case StaticShapeType::Box:
+                return {x - halfWidth, y - halfHeight, x + halfWidth, y + halfHeight};
+            case StaticShapeType::Circle:
+                return {x - radius, y - radius, x + radius, y + radius};
+        }
+        return AABB::empty();
+    }
+
+    /**
+     * @brief Adds a segment.
+     * @param start
+     *          One end of the segment.
+     * @param end
+     *          The other end of the segment.
+     * @return The index of the shape.
+     */
+    std::size_t StaticWorld::addSegment(const math::Vec2f& start, const math::Vec2f& end) {
+        return addShape({StaticShapeType::Segment, start.getX(), start.getY(), end.getX(), end.getY(), 0.f, 0.f,
+                         0.f});
+    }
+
+    /**
+     * @brief Adds a box.
+     * @param center
+     *          The center of the box.
+     * @param width
+     *          The width of the box.
+     * @param height
+     *          The height of the box.
+     * @return The index of the shape.
+     */
+    std::size_t StaticWorld::addBox(const math::Vec2f& center, math::f32 width, math::f32 height) {
+        return addShape({StaticShapeType::Box, center.getX(), center.getY(), 0.f, 0.f, width / 2.f, height / 2.f,
+                         0.f});
+    }
+
+    /**
+     * @brief Adds a circle.
+     * @param center
+     *          The center of the circle.
+     * @param radius
+     *          The radius of the circle.
+     * @return The index of the shape.
+     */
+    std::size_t StaticWorld::addCircle(const math::Vec2f& center, math::f32 radius) {
+        return addShape({StaticShapeType::Circle, center.getX(), center.getY(), 0.f, 0.f, 0.f, 0.f, radius});
+    }
+
+    /**
+     * @brief Adds a polyline as one segment per pair of consecutive points.
+     * @param points
+     *          The points, at least two.
+     * @param closed
+     *          Whether to also join the last point back to the first.
+     * @return The index of the first segment, or the shape count if there were too few points to add any.
+     */
+    std::size_t StaticWorld::addPolyline(const std::vector<math::Vec2f>& points, bool closed) {
+        const std::size_t first{shapes.size()};
+        for (std::size_t i{1}; i < points.size(); ++i) {
+            addSegment(points[i - 1], points[i]);
+        }
+        if (closed && points.size() > 2) {
+            addSegment(points.back(), points.front());
+        }
+        return first;
+    }
+
+    /**
+     * @brief Removes every shape.
+     */
+    void StaticWorld::clear() {
+        shapes.clear();
+        nodes.clear();
+        leafShapes.clear();
+        shapeBounds.clear();
+        ++revision;
+        built = true;
+    }
+
+    /**
+     * @brief Builds the hierarchy over the current shapes. Only needed after shapes were added.
+     */
+    void StaticWorld::build() {
+        shapeBounds.resize(shapes.size());
+        leafShapes.resize(shapes.size());
+        for (std::size_t i{0}; i < shapes.size(); ++i) {
+            shapeBounds[i] = shapes[i].getBounds();
+            leafShapes[i] = static_cast<std::uint32_t>(i);
+        }
+
+        nodes.clear();
+        nodes.reserve(shapes.size() / maxLeafShapes * 2 + 1);
+        if (!shapes.empty()) {
+            buildNode(0, shapes.size());
+        }
+        built = true;
+    }
+
+    /**
+     * @brief Checks whether the hierarchy covers every shape.
+     * @return True if no shape was added since the last @c build.
+     */
+    bool StaticWorld::isBuilt() const {
+        return built;
+    }
+
+    /**
+     * @brief Gets the number of shapes, counting each segment of a polyline.
+     * @return The shape count.
+     */
+    std::size_t StaticWorld::size() const {
+        return shapes.size();
+    }
+
+    /**
+     * @brief Checks whether there are no shapes.
+     * @return True if empty.
+     */
+    bool StaticWorld::isEmpty() const {
+        return shapes.empty();
+    }
+
+    /**
+     * @brief Gets a number that changes whenever shapes are added or removed, so copies of the shapes can tell
+     * when they are out of date.
+     * @return The revision.
+     */
+    std::uint64_t StaticWorld::getRevision() const {
+        return revision;
+    }
+
+    /**
+     * @brief Gets the box around every shape. Only valid after @c build.
+     * @return The bounds, empty if there are no shapes.
+     */
+    AABB StaticWorld::getBounds() const {
+        return nodes.empty() ? AABB::empty() : nodes.front().box;
+    }
+
+    /**
+     * @brief Gets every shape, in the order they were added.
+     * @return The shapes.
+     */
+    const std::vector<StaticShape>& StaticWorld::getShapes() const {
+        return shapes;
+    }
+
+    /**
+     * @brief Appends a shape and marks the hierarchy as out of date.
+     * @param shape
+     *          The shape.
+     * @return The index of the shape.
+     */
+    std::size_t StaticWorld::addShape(const StaticShape& shape) {
+        shapes.push_back(shape);
+        ++revision;
+        built = false;
+        return shapes.size() - 1;
+    }
+
+    /**
+     * @brief Builds the subtree over a range of @c leafShapes, splitting it at the median center along the longer
+     * axis of the centers until a range fits in a leaf.
+     * @param first
+     *          The start of the range.
+     * @param last
+     *          The end of the range.
+     * @return The index of the subtree's root, which is followed by its first child.
+     */
+    std::uint32_t StaticWorld::buildNode(std::size_t first, std::size_t last) {
+        const auto index{static_cast<std::uint32_t>(nodes.size())};
+        nodes.push_back({AABB::empty(), static_cast<std::uint32_t>(first), static_cast<std::uint32_t>(last - first)});
+
+        AABB box{AABB::empty()};
+        AABB centers{AABB::empty()};
+        for (std::size_t k{first}; k < last; ++k) {
+            const AABB& bounds{shapeBounds[leafShapes[k]]};
+            const math::f32 cx{(bounds.minX + bounds.maxX) / 2.f};
+            const math::f32 cy{(bounds.minY + bounds.maxY) / 2.f};
+            box = box.merged(bounds);
+            centers = centers.merged({cx, cy, cx, cy});
+        }
+        nodes[index].box = box;
+        if (last - first <= maxLeafShapes) {
+            return index;
+        }
+
+        const bool splitX{centers.maxX - centers.minX >= centers.maxY - centers.minY};
+        const std::size_t middle{first + (last - first) / 2};
+        std::nth_element(leafShapes.begin() + static_cast<std::ptrdiff_t>(first),
+                         leafShapes.begin() + static_cast<std::ptrdiff_t>(middle),
+                         leafShapes.begin() + static_cast<std::ptrdiff_t>(last),
+                         [this, splitX](std::uint32_t lhs, std::uint32_t rhs) {
+            const AABB& a{shapeBounds[lhs]};
+            const AABB& b{shapeBounds[rhs]};
+            return splitX ? a.minX + a.maxX < b.minX + b.maxX : a.minY + a.maxY < b.minY + b.maxY;
+        });
+
+        nodes[index].count = 0;
+        buildNode(first, middle);
+        nodes[index].first = buildNode(middle, last);
+        return index;
+    }
+} // namespace physx::collision
@@ -0,0 +1,130 @@
+/**
+ * @file SweepAndPrune.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/collision/SweepAndPrune.hpp"
+
+#include <algorithm>
+
+namespace physx::collision {
+    /**
+     * @brief Brings the endpoints up to date with the bounds of every body and restores their order.
+     *
+     * Endpoints of new bodies are appended and those of removed bodies dropped. When only a few endpoints were
+     * added the array is re-sorted with an insertion sort, otherwise it is sorted from scratch.
+     * @param boxes
+     *          The bounds of each body, empty for bodies that should be ignored.
+     * @param count
+     *          The number of bodies.
+     */
+    void SweepAndPrune::update(const AABB* boxes, std::size_t count) {
+        bool removed{tracked.size() > count};
+        std::size_t added{0};
+
+        tracked.resize(count, 0);
+        for (std::size_t i{0}; i < count; ++i) {
+            const bool empty{boxes[i].isEmpty()};
+            if (tracked[i] != 0 && empty) {
+                tracked[i] = 0;
+                removed = true;
+            } else if (tracked[i] == 0 && !empty) {
+                tracked[i] = 1;
+                const auto data{static_cast<std::uint32_t>(i << 1)};
+                endpoints.push_back({0.f, data});
+                endpoints.push_back({0.f, data | 1});
+                ++added;
+            }
+        }
+
+        if (removed) {
+            endpoints.erase(std::remove_if(endpoints.begin(), endpoints.end(), [this, count](const Endpoint& e) {
+                return e.body() >= count || tracked[e.body()] == 0;
+            }), endpoints.end());
+        }
+
+        for (auto& endpoint : endpoints) {
+            const AABB& box{boxes[endpoint.body()]};
+            endpoint.value = endpoint.isMax() ? box.maxX : box.minX;
+        }
+
+        // Each appended endpoint may travel the whole array, so a bulk insert is cheaper to sort from scratch.
+        swapCount = 0;
+        if (added * 8 > endpoints.size()) {
+            std::sort(endpoints.begin(), endpoints.end(), less);
+        } else {
+            insertionSort();
+        }
+    }
+
+    /**
+     * @brief Sweeps the sorted endpoints and reports every pair of bodies whose boxes overlap.
+     *
+     * Pairs are reported once, with the lower body index first.
+     * @param boxes
+     *          The bounds of each body, as passed to the last @c update.
+     * @param pairs
+     *          Receives the pairs.
+     */
+    void SweepAndPrune::findPairs(const AABB* boxes, std::vector<CollisionPair>& pairs) {
+        active.clear();
+        activeSlot.resize(tracked.size());
+
+        for (const auto& endpoint : endpoints) {
+            const std::uint32_t body{endpoint.body()};
+
+            if (endpoint.isMax()) {
+                const std::uint32_t slot{activeSlot[body]};
+                active[slot] = active.back();
+                activeSlot[active[slot]] = slot;
+                active.pop_back();
+                continue;
+            }
+
+            const AABB& box{boxes[body]};
+            for (const std::uint32_t other : active) {
+                if (box.minY <= boxes[other].maxY && boxes[other].minY <= box.maxY) {
+                    pairs.push_back({std::min(body, other), std::max(body, other)});
+                }
+            }
+
+            activeSlot[body] = static_cast<std::uint32_t>(active.size());
+            active.push_back(body);
+        }
+    }
+
+    /**
+     * @brief Drops every endpoint.
+     */
+    void SweepAndPrune::clear() {
+        endpoints.clear();
+        tracked.clear();
+    }
+
+    /**
+     * @brief Gets the number of endpoint swaps the last @c update made, zero if it sorted from scratch.
+     * @return The swap count.
+     */
+    std::size_t SweepAndPrune::getSwapCount() const {
+        return swapCount;
+    }
+
+    bool SweepAndPrune::less(const Endpoint& lhs, const Endpoint& rhs) {
+        return lhs.value < rhs.value || (lhs.value == rhs.value && !lhs.isMax() && rhs.isMax());
+    }
+
+    void SweepAndPrune::insertionSort() {
+        for (std::size_t i{1}; i < endpoints.size(); ++i) {
+            const Endpoint key{endpoints[i]};
+            std::size_t k{i};
+            while (k > 0 && less(key, endpoints[k - 1])) {
+                endpoints[k] = endpoints[k - 1];
+                --k;
+            }
+            swapCount += i - k;
+            endpoints[k] = key;
+        }
+    }
+} // namespace physx::collision
@@ -0,0 +1,153 @@
+/**
+ * @file UniformGrid.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/collision/UniformGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace physx::collision {
+    /**
+     * @brief @c UniformGrid constructor.
+     * @param min
+     *          The top-left corner of the region covered by the grid.
+     * @param max
+     *          The bottom-right corner of the region covered by the grid.
+     */
+    UniformGrid::UniformGrid(const math::Vec2f& min, const math::Vec2f& max)
+        : min{min},
+          max{max} {
+    }
+
+    /**
+     * @brief Sets the region covered by the grid, taking effect at the next @c build.
+     * @param newMin
+     *          The top-left corner of the region.
+     * @param newMax
+     *          The bottom-right corner of the region.
+     */
+    void UniformGrid::setBounds(const math::Vec2f& newMin, const math::Vec2f& newMax) {
+        min = newMin;
+        max = newMax;
+    }
+
+    /**
+     * @brief Rebuilds the grid from the current body positions.
+     *
+     * Bodies outside the covered region are clamped into the border cells, which keeps the pair search correct
+     * (just less selective) for anything that has escaped the region.
+     * @param x
+     *          The x-components of the body centers.
+     * @param y
+     *          The y-components of the body centers.
+     * @param count
+     *          The number of bodies.
+     * @param minCellSize
+     *          The smallest allowed cell size, normally the largest body diameter.
+     * @param active
+     *          Non-zero for bodies that are moving, or @c nullptr if every body is.
+     */
+    void UniformGrid::build(const math::f32* x, const math::f32* y, std::size_t count, math::f32 minCellSize,
+                            const std::uint8_t* active) {
+        const math::f32 width{max.getX() - min.getX()};
+        const math::f32 height{max.getY() - min.getY()};
+
+        cellSize = std::max({minCellSize, width / maxCellsPerAxis, height / maxCellsPerAxis, 1e-3f});
+        columns = std::max(1, static_cast<math::i32>(std::ceil(width / cellSize)));
+        rows = std::max(1, static_cast<math::i32>(std::ceil(height / cellSize)));
+
+        const std::size_t cellCount{static_cast<std::size_t>(columns) * static_cast<std::size_t>(rows)};
+        cellStart.assign(cellCount + 1, 0);
+        bodyCells.resize(count);
+        cellBodies.resize(count);
+
+        ///< Counting sort: histogram, prefix sum, scatter.
+        for (std::size_t i{0}; i < count; ++i) {
+            const math::i32 column{toCell(x[i], min.getX(), columns)};
+            const math::i32 row{toCell(y[i], min.getY(), rows)};
+            const auto cell{static_cast<std::uint32_t>(row * columns + column)};
+
+            bodyCells[i] = cell;
+            ++cellStart[cell + 1];
+        }
+
+        for (std::size_t c{0}; c < cellCount; ++c) {
+            cellStart[c + 1] += cellStart[c];
+        }
+
+        cellFill.assign(cellStart.begin(), cellStart.end() - 1);
+        for (std::size_t i{0}; i < count; ++i) {
+            cellBodies[cellFill[bodyCells[i]]++] = static_cast<std::uint32_t>(i);
+        }
+
+        if (active == nullptr) {
+            cellActive.clear();
+            return;
+        }
+
+        cellActive.assign(cellCount, 0);
+        for (std::size_t i{0}; i < count; ++i) {
+            cellActive[bodyCells[i]] |= active[i] != 0 ? 1 : 0;
+        }
+    }
+
+    /**
+     * @brief Finds every pair of bodies that share a cell or sit in neighbouring cells.
+     * @param pairs
+     *          Cleared and filled with the candidate pairs.
+     */
+    void UniformGrid::findPairs(std::vector<CollisionPair>& pairs) const {
+        pairs.clear();
+
+        for (math::i32 row{0}; row < rows; ++row) {
+            for (math::i32 column{0}; column < columns; ++column) {
+                forEachPair(column, row, [&pairs](std::uint32_t a, std::uint32_t b) {
+                    pairs.push_back({a, b});
+                });
+            }
+        }
+    }
+
+    /**
+     * @brief Gets the size of a grid cell from the last build.
+     * @return The cell size.
+     */
+    math::f32 UniformGrid::getCellSize() const {
+        return cellSize;
+    }
+
+    /**
+     * @brief Gets the number of columns from the last build.
+     * @return The number of columns.
+     */
+    math::i32 UniformGrid::getColumns() const {
+        return columns;
+    }
+
+    /**
+     * @brief Gets the number of rows from the last build.
+     * @return The number of rows.
+     */
+    math::i32 UniformGrid::getRows() const {
+        return rows;
+    }
+
+    /**
+     * @brief Converts a coordinate to a clamped cell coordinate along one axis.
+     * @param value
+     *          The coordinate.
+     * @param origin
+     *          The start of the grid along the axis.
+     * @param cells
+     *          The number of cells along the axis.
+     * @return The cell coordinate.
+     */
+    math::i32 UniformGrid::toCell(math::f32 value, math::f32 origin, math::i32 cells) const {
+        const auto cell{static_cast<math::i32>(std::floor((value - origin) / cellSize))};
+        return std::clamp(cell, 0, cells - 1);
+    }
+} // namespace physx::collision
@@ -7,14 +7,17 @@
 
 #include "../../include/physx/core/Engine.hpp"
 
+#include <chrono>
+
+#include "../../include/physx/utilities/RandomNumberGenerator.hpp"
+
 namespace physx::core {
     /**
      * @brief @c Engine constructor.
      * @param simulation
      *          The simulation to run.
      */
-    Engine::Engine()
-        : dtClock{true} {
+    Engine::Engine() {
         utils::configureLLOG();
         LLOG_INFO("physx starting...")
         setupWindow();
@@ -27,26 +30,33 @@ namespace physx::core {
      * @brief @c Engine destructor.
      */
     Engine::~Engine() {
+        stopPhysics();
         delete window;
         delete renderer;
         delete simulation;
     }
 
     /**
-     * @brief Starts the simulation.
+     * @brief Starts the simulation, stepping it on the physics thread and drawing its latest snapshot until the
+     * window is closed.
      */
     void Engine::startSimulation() {
         LLOG_INFO("Started simulation...")
         if (window != nullptr) {
+            publishSnapshot();
+            running.store(true, std::memory_order_release);
+            physicsThread = std::thread{&Engine::physicsLoop, this};
+
             while (window->isOpen()) {
                 updateEvents();
-                updateDeltaClock();
-                simulation->update(deltaTime);
+                checkForMouseEvents();
 
                 window->clear();
-                renderer->render(*simulation);
+                renderer->render(snapshots.read());
                 window->display();
             }
+
+            stopPhysics();
         }
     }
 
@@ -59,6 +69,117 @@ namespace physx::core {
         simulation = theSimulation;
     }
 
+    /**
+     * @brief Sets the number of physics steps per second, independent of the render rate.
+     * @param rate
+     *          The physics rate in Hz.
+     */
+    void Engine::setPhysicsRate(math::f32 rate) {
+        timestep.setRate(rate);
+    }
+
+    /**
+     * @brief Sets the number of sub-steps each physics step is split into.
+     * @param subSteps
+     *          The number of sub-steps.
+     */
+    void Engine::setSubSteps(std::size_t subSteps) {
+        timestep.setSubSteps(subSteps);
+    }
+
+    /**
+     * @brief Sets the most physics steps a single frame may catch up on after a slow frame.
+     * @param maxStepsPerFrame
+     *          The cap.
+     */
+    void Engine::setMaxStepsPerFrame(std::size_t maxStepsPerFrame) {
+        timestep.setMaxStepsPerFrame(maxStepsPerFrame);
+    }
+
+    /**
+     * @brief Sets the render frame rate limit.
+     * @param limit
+     *          The frame rate limit, or 0 for none.
+     */
+    void Engine::setFramerateLimit(unsigned int limit) {
+        if (window != nullptr) {
+            window->setFramerateLimit(limit);
+        }
+    }
+
+    /**
+     * @brief Starts recording the body positions after every physics step to a trajectory file, replacing any
+     * recording in progress. Must not be called while @c startSimulation is running, since the physics thread reads
+     * the recorder without synchronisation.
+     * @param path
+     *          The path of the trajectory file.
+     * @throws except::TrajectoryException
+     *          If the file cannot be created.
+     */
+    void Engine::startRecording(const std::string& path) {
+        stopRecording();
+        recorder = std::make_unique<utils::TrajectoryRecorder>(path);
+        LLOG_INFO("Recording trajectory to {}.", path)
+    }
+
+    /**
+     * @brief Finishes the recording in progress, if any. Must not be called while @c startSimulation is running.
+     * @throws except::TrajectoryException
+     *          If the trajectory could not be written.
+     */
+    void Engine::stopRecording() {
+        if (recorder != nullptr) {
+            const std::unique_ptr<utils::TrajectoryRecorder> finished{std::move(recorder)};
+            finished->close();
+        }
+    }
+
+    /**
+     * @brief Makes the run reproducible: physics steps run back to back as fast as they can instead of following
+     * the wall clock, and the shared random number stream starts from a seed.
+     *
+     * Spawns are always logged with the step they happen before, so together with the seed the run can be replayed
+     * bit for bit with @c startReplay after saving the log.
+     * @param seed
+     *          The seed of the random number stream.
+     */
+    void Engine::setDeterministic(std::uint64_t seed) {
+        deterministic = true;
+        utils::RNG::seed(seed);
+        inputLog.setSeed(seed);
+        LLOG_INFO("Deterministic mode with seed {}.", seed)
+    }
+
+    /**
+     * @brief Replays an input log saved by @c saveInputLog in deterministic mode. The mouse is ignored while
+     * replaying. The simulation must start from the same scene as the recorded run.
+     * @param path
+     *          The path of the input log.
+     * @throws except::SceneLoadException
+     *          If the log cannot be loaded.
+     */
+    void Engine::startReplay(const std::string& path) {
+        inputLog.load(path);
+        setDeterministic(inputLog.getSeed());
+        replaying = true;
+        LLOG_INFO("Replaying {} spawns from {}.", inputLog.getCommands().size(), path)
+    }
+
+    /**
+     * @brief Saves every spawn so far, with the seed and the current sub-step size, for @c startReplay. Must not be
+     * called while @c startSimulation is running.
+     * @param path
+     *          The path of the input log.
+     * @throws except::SceneLoadException
+     *          If the log cannot be written.
+     */
+    void Engine::saveInputLog(const std::string& path) {
+        if (!replaying) {
+            inputLog.setStepSize(timestep.getSubStepSize());
+        }
+        inputLog.save(path);
+    }
+
     /**
      * @brief Checks for an @c sf::Event::Closed polled from the simulation window.
      */
@@ -79,12 +200,114 @@ namespace physx::core {
     }
 
     /**
-     * @brief Updates the delta clock.
+     * @brief Queues a @c Circle2D spawn at the position of the mouse when the left button is pressed. The physics
+     * thread logs it before its next step. Clicks are dropped while the queue is full.
+     */
+    void Engine::checkForMouseEvents() {
+        if (replaying) {
+            return;
+        }
+
+        if (utils::Mouse::mousePressed(sf::Mouse::Left) && !mousePressed) {
+            mousePressed = true;
+            if (math::Vec2f* position{spawnQueue.acquire()}) {
+                *position = utils::Mouse::getRelativePosition();
+                spawnQueue.publish();
+            }
+        }
+
+        if (!utils::Mouse::mousePressed(sf::Mouse::Left)) {
+            mousePressed = false;
+        }
+    }
+
+    /**
+     * @brief Runs on the physics thread until @c stopPhysics: steps the simulation at a fixed step size, as fast as
+     * possible in deterministic mode and paced by the wall clock otherwise, and publishes a snapshot after each
+     * batch of steps.
+     *
+     * A snapshot is only captured once the render thread has picked up the previous one, so stepping faster than
+     * the frame rate does not pay for copies that would never be drawn.
+     */
+    void Engine::physicsLoop() {
+        using Clock = std::chrono::steady_clock;
+        Clock::time_point previous{Clock::now()};
+
+        while (running.load(std::memory_order_acquire)) {
+            drainSpawnQueue();
+
+            std::size_t steps{1};
+            if (!deterministic) {
+                const Clock::time_point now{Clock::now()};
+                steps = timestep.advance(std::chrono::duration<math::f32>{now - previous}.count());
+                previous = now;
+            }
+
+            if (steps > 0) {
+                stepSimulation(steps);
+                if (!snapshots.isPending()) {
+                    publishSnapshot();
+                }
+            } else {
+                ///< Sleep until the next step is due.
+                const math::f32 wait{(1.f - timestep.getAlpha()) * timestep.getStepSize()};
+                std::this_thread::sleep_for(std::chrono::duration<math::f32>{wait});
+            }
+        }
+    }
+
+    /**
+     * @brief Stops the physics thread and waits for it to finish its current steps.
+     */
+    void Engine::stopPhysics() {
+        running.store(false, std::memory_order_release);
+        if (physicsThread.joinable()) {
+            physicsThread.join();
+        }
+    }
+
+    /**
+     * @brief Logs the spawns queued by the render thread at the current step, so they are applied before it.
+     */
+    void Engine::drainSpawnQueue() {
+        if (replaying) {
+            return;
+        }
+
+        while (const math::Vec2f* position{spawnQueue.peek()}) {
+            inputLog.add({simulation->getStepCount(), dynamic::ShapeType::Circle, 20.f, 0.f, *position, true,
+                          dynamic::IntegrationType::Verlet});
+            spawnQueue.release();
+        }
+    }
+
+    /**
+     * @brief Runs physics steps at a fixed step size, recording each one if a recording is in progress. Logged
+     * spawns are added right before the sub-step they belong to.
+     * @param steps
+     *          The number of steps to run.
+     */
+    void Engine::stepSimulation(std::size_t steps) {
+        const math::f32 dt{replaying ? inputLog.getStepSize() : timestep.getSubStepSize()};
+        for (std::size_t step{0}; step < steps; ++step) {
+            for (std::size_t i{0}; i < timestep.getSubSteps(); ++i) {
+                inputLog.apply(*simulation);
+                simulation->update(dt);
+            }
+
+            if (recorder != nullptr) {
+                const dynamic::BodyStore& bodies{simulation->getBodies()};
+                recorder->record(bodies.getPositionX(), bodies.getPositionY(), bodies.size());
+            }
+        }
+    }
+
+    /**
+     * @brief Copies the drawable state of the simulation into the triple buffer for the render thread.
      */
-    void Engine::updateDeltaClock() {
-        dtClock.stop();
-        deltaTime = dtClock.GetElapsedTime().asSeconds();
-        dtClock.start();
+    void Engine::publishSnapshot() {
+        snapshots.getWriteBuffer().capture(*simulation);
+        snapshots.publish();
     }
 
     /**
@@ -0,0 +1,247 @@
+/**
+ * @file InputLog.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/core/InputLog.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace physx::core {
+    namespace {
+        const char* integrationNames[dynamic::integrationTypeCount]{"euler", "verlet", "rk4"};
+
+        /**
+         * @brief Reads a float written in any format @c std::strtof accepts, including hexadecimal.
+         * @param stream
+         *          The stream to read the next token from.
+         * @param value
+         *          Receives the float.
+         * @return @c false if the token is missing or not a float.
+         */
+        bool readFloat(std::istream& stream, math::f32& value) {
+            std::string token;
+            if (!(stream >> token)) {
+                return false;
+            }
+
+            char* end;
+            value = std::strtof(token.c_str(), &end);
+            return end == token.c_str() + token.size();
+        }
+
+        bool readBody(std::istream& stream, bool& rb, dynamic::IntegrationType& integration) {
+            std::string motion, integrationName;
+            if (!(stream >> motion >> integrationName) || (motion != "dynamic" && motion != "static")) {
+                return false;
+            }
+            rb = motion == "dynamic";
+
+            const auto* name{std::find(std::begin(integrationNames), std::end(integrationNames), integrationName)};
+            integration = static_cast<dynamic::IntegrationType>(name - std::begin(integrationNames));
+            return name != std::end(integrationNames);
+        }
+    } // namespace
+
+    /**
+     * @brief Records a spawn command, keeping the commands in step order.
+     * @param command
+     *          The command.
+     */
+    void InputLog::add(const SpawnCommand& command) {
+        const auto position{std::upper_bound(commands.begin() + static_cast<std::ptrdiff_t>(next), commands.end(),
+                                             command.step, [](std::uint64_t step, const SpawnCommand& other) {
+                                                 return step < other.step;
+                                             })};
+        commands.insert(position, command);
+    }
+
+    /**
+     * @brief Carries out every command due before the next step of a simulation. Call right before each
+     * @c Simulation::update.
+     * @param simulation
+     *          The @c Simulation to apply the commands to.
+     * @return The number of commands carried out.
+     */
+    std::size_t InputLog::apply(Simulation& simulation) {
+        const std::uint64_t step{simulation.getStepCount()};
+        const std::size_t first{next};
+
+        for (; next < commands.size() && commands[next].step <= step; ++next) {
+            const SpawnCommand& command{commands[next]};
+            if (command.shape == dynamic::ShapeType::Circle) {
+                simulation.addCircleObject(command.width, command.position, command.rb, command.integration);
+            } else {
+                simulation.addRectangleObject(command.width, command.height, command.position, command.rb,
+                                              command.integration);
+            }
+        }
+        return next - first;
+    }
+
+    /**
+     * @brief Starts applying the commands from the beginning again, for another replay.
+     */
+    void InputLog::rewind() {
+        next = 0;
+    }
+
+    /**
+     * @brief Removes every command.
+     */
+    void InputLog::clear() {
+        commands.clear();
+        next = 0;
+    }
+
+    /**
+     * @brief Saves the log to a file.
+     * @param path
+     *          The path of the file.
+     * @throws except::SceneLoadException
+     *          If the file cannot be written.
+     */
+    void InputLog::save(const std::string& path) const {
+        std::ofstream file{path};
+        save(file);
+        if (!file) {
+            throw except::SceneLoadException("Cannot write input log " + path + ".");
+        }
+    }
+
+    /**
+     * @brief Writes the log.
+     * @param output
+     *          The stream to write to.
+     */
+    void InputLog::save(std::ostream& output) const {
+        output << "# physx input log\n";
+        output << "seed " << seed << "\n";
+        output << std::hexfloat << "dt " << stepSize << "\n";
+
+        for (const SpawnCommand& command : commands) {
+            if (command.shape == dynamic::ShapeType::Circle) {
+                output << "circle " << command.step << " " << command.width;
+            } else {
+                output << "rectangle " << command.step << " " << command.width << " " << command.height;
+            }
+            output << " " << command.position.getX() << " " << command.position.getY() << " "
+                   << (command.rb ? "dynamic " : "static ")
+                   << integrationNames[static_cast<std::size_t>(command.integration)] << "\n";
+        }
+    }
+
+    /**
+     * @brief Replaces the log with one loaded from a file.
+     * @param path
+     *          The path of the file.
+     * @throws except::SceneLoadException
+     *          If the file cannot be opened or contains an invalid command.
+     */
+    void InputLog::load(const std::string& path) {
+        std::ifstream file{path};
+        if (!file) {
+            throw except::SceneLoadException("Cannot open input log " + path + ".");
+        }
+        load(file);
+    }
+
+    /**
+     * @brief Replaces the log with one read from a stream.
+     * @param input
+     *          The stream to read from.
+     * @throws except::SceneLoadException
+     *          If the log contains an invalid command.
+     */
+    void InputLog::load(std::istream& input) {
+        clear();
+
+        std::string line;
+        std::size_t lineNumber{0};
+        while (std::getline(input, line)) {
+            ++lineNumber;
+
+            std::istringstream stream{line};
+            std::string command;
+            if (!(stream >> command) || command[0] == '#') {
+                continue;
+            }
+
+            SpawnCommand spawn{};
+            math::f32 x, y;
+            bool valid{false};
+
+            if (command == "seed") {
+                valid = static_cast<bool>(stream >> seed);
+            } else if (command == "dt") {
+                valid = readFloat(stream, stepSize) && stepSize > 0.f;
+            } else if (command == "circle") {
+                spawn.shape = dynamic::ShapeType::Circle;
+                valid = (stream >> spawn.step) && readFloat(stream, spawn.width) && readFloat(stream, x) &&
+                        readFloat(stream, y) && readBody(stream, spawn.rb, spawn.integration);
+            } else if (command == "rectangle") {
+                spawn.shape = dynamic::ShapeType::Rectangle;
+                valid = (stream >> spawn.step) && readFloat(stream, spawn.width) &&
+                        readFloat(stream, spawn.height) && readFloat(stream, x) && readFloat(stream, y) &&
+                        readBody(stream, spawn.rb, spawn.integration);
+            }
+
+            if (!valid) {
+                throw except::SceneLoadException("Invalid input log command on line " + std::to_string(lineNumber) +
+                                                 ": " + line);
+            }
+
+            if (command == "circle" || command == "rectangle") {
+                spawn.position = {x, y};
+                add(spawn);
+            }
+        }
+    }
+
+    /**
+     * @brief Sets the seed the run's random number stream starts from.
+     * @param newSeed
+     *          The seed.
+     */
+    void InputLog::setSeed(std::uint64_t newSeed) {
+        seed = newSeed;
+    }
+
+    /**
+     * @brief Gets the seed the run's random number stream starts from.
+     * @return The seed.
+     */
+    std::uint64_t InputLog::getSeed() const {
+        return seed;
+    }
+
+    /**
+     * @brief Sets the time step every @c Simulation::update of the run uses.
+     * @param newStepSize
+     *          The time step.
+     */
+    void InputLog::setStepSize(math::f32 newStepSize) {
+        stepSize = newStepSize;
+    }
+
+    /**
+     * @brief Gets the time step every @c Simulation::update of the run uses.
+     * @return The time step.
+     */
+    math::f32 InputLog::getStepSize() const {
+        return stepSize;
+    }
+
+    /**
+     * @brief Gets the recorded commands, in step order.
+     * @return The commands.
+     */
+    const std::vector<SpawnCommand>& InputLog::getCommands() const {
+        return commands;
+    }
+} // namespace physx::core
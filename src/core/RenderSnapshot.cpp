@@ -0,0 +1,42 @@
+/**
+ * @file RenderSnapshot.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/core/RenderSnapshot.hpp"
+
+namespace physx::core {
+    /**
+     * @brief Copies the drawable state of a simulation into the snapshot, replacing its contents.
+     * @param simulation
+     *          The simulation to copy.
+     */
+    void RenderSnapshot::capture(const Simulation& simulation) {
+        const dynamic::BodyStore& bodies{simulation.getBodies()};
+        const std::size_t count{bodies.size()};
+
+        step = simulation.getStepCount();
+        constraintCenter = simulation.getConstraintCenter();
+        constraintRadius = simulation.getConstraintRadius();
+        if (colliderRevision != simulation.getColliders().getRevision()) {
+            colliders = simulation.getColliders().getShapes();
+            colliderRevision = simulation.getColliders().getRevision();
+        }
+        shape.assign(bodies.getShape(), bodies.getShape() + count);
+        positionX.assign(bodies.getPositionX(), bodies.getPositionX() + count);
+        positionY.assign(bodies.getPositionY(), bodies.getPositionY() + count);
+        radius.assign(bodies.getRadius(), bodies.getRadius() + count);
+        width.assign(bodies.getWidth(), bodies.getWidth() + count);
+        height.assign(bodies.getHeight(), bodies.getHeight() + count);
+    }
+
+    /**
+     * @brief Gets the number of body slots in the snapshot, including removed ones.
+     * @return The slot count.
+     */
+    std::size_t RenderSnapshot::size() const {
+        return shape.size();
+    }
+} // namespace physx::core
@@ -8,66 +8,159 @@
 #include "../../include/physx/core/Renderer.hpp"
 
 namespace physx::core {
+    /**
+     * @brief @c Renderer constructor.
+     * @param target
+     *          The target to draw to.
+     */
     Renderer::Renderer(sf::RenderTarget* target)
         : target{target} {
+        boundary.setFillColor(sf::Color::White);
+        boundary.setPointCount(128);
+        setupCircleTexture();
     }
 
-    void Renderer::render(Simulation simulation) {
+    /**
+     * @brief Draws the boundary, the colliders and every body in a snapshot of the simulation.
+     * @param snapshot
+     *          The snapshot to draw.
+     */
+    void Renderer::render(const RenderSnapshot& snapshot) {
         // Constraints
-        sf::CircleShape bg{450.f};
-        bg.setOrigin(450.f, 450.f);
-        bg.setFillColor(sf::Color::White);
-        bg.setPosition(500.f, 500.f);
-        bg.setPointCount(128);
-        target->draw(bg);
+        const math::f32 radius{snapshot.constraintRadius};
+        if (radius > 0.f) {
+            boundary.setRadius(radius);
+            boundary.setOrigin(radius, radius);
+            boundary.setPosition(snapshot.constraintCenter.getX(), snapshot.constraintCenter.getY());
+            target->draw(boundary);
+        }
 
+        if (colliderRevision != snapshot.colliderRevision) {
+            buildColliderBatches(snapshot);
+        }
+        if (colliderCircles.getVertexCount() > 0) {
+            target->draw(colliderCircles, sf::RenderStates{&circleTexture.getTexture()});
+        }
+        if (colliderBoxes.getVertexCount() > 0) {
+            target->draw(colliderBoxes);
+        }
+        if (colliderSegments.getVertexCount() > 0) {
+            target->draw(colliderSegments);
+        }
 
         ///< Objects
-        auto objects{simulation.getObjects()};
-
-//        sf::CircleShape circle;
-//        circle.setPointCount(32);
-//        circle.setOrigin(1.f, 1.f);
-//
-//        for (auto& obj : objects) {
-//            // Circle2D
-////            if (dynamic_cast<object::Circle2D*>(obj) != nullptr) {
-//                // Circle2D Obj
-//                auto* cast{dynamic_cast<object::Circle2D*>(obj)};
-//                circle.setPosition(obj->getRb()->getPosition().getX(), obj->getRb()->getPosition().getY());
-//                circle.setScale(cast->getRadius(), cast->getRadius());
-//                circle.setFillColor(sf::Color::Red);
-//                target->draw(circle);
-////            }
-//        }
-
-        sf::CircleShape circle{1.f};
-        circle.setPointCount(32);
-        circle.setOrigin(1.f, 1.f);
-
-        sf::RectangleShape rect{{1.f, 1.f}};
-        rect.setOrigin(1.f, 1.f);
-
-        for (auto& obj : objects) {
-            object::Circle2D* cast{dynamic_cast<object::Circle2D*>(obj)};
-
-//            circle.setPosition(obj->getRb()->getPosition().getX(), obj->getRb()->getPosition().getY());
-//            circle.setScale(cast->getRadius(), cast->getRadius());
-//            circle.setFillColor(sf::Color::Red);
-//            target->draw(circle);
-
-            if (cast) {
-                circle.setPosition(obj->getRb()->getPosition().getX(), obj->getRb()->getPosition().getY());
-                circle.setScale(cast->getRadius(), cast->getRadius());
-                circle.setFillColor(sf::Color::Red);
-                target->draw(circle);
-            } else {
-                auto cast1 = dynamic_cast<object::Rectangle2D*>(obj);
-                rect.setPosition(obj->getRb()->getPosition().getX(), obj->getRb()->getPosition().getY());
-                rect.setScale(cast1->getWidth(), cast1->getHeight());
-                rect.setFillColor(sf::Color::Blue);
-                target->draw(rect);
+        buildBatches(snapshot);
+
+        if (circles.getVertexCount() > 0) {
+            target->draw(circles, sf::RenderStates{&circleTexture.getTexture()});
+        }
+        if (rectangles.getVertexCount() > 0) {
+            target->draw(rectangles);
+        }
+    }
+
+    /**
+     * @brief Pre-renders the white circle every circle quad samples from.
+     */
+    void Renderer::setupCircleTexture() {
+        const auto half{static_cast<math::f32>(circleTextureSize) / 2.f};
+
+        circleTexture.create(circleTextureSize, circleTextureSize);
+        circleTexture.clear(sf::Color::Transparent);
+
+        sf::CircleShape circle{half};
+        circle.setPointCount(64);
+        circle.setFillColor(sf::Color::White);
+        circleTexture.draw(circle);
+
+        circleTexture.display();
+        circleTexture.setSmooth(true);
+    }
+
+    /**
+     * @brief Rebuilds the circle and rectangle vertex arrays from the body state.
+     * @param snapshot
+     *          The snapshot holding the bodies to draw.
+     */
+    void Renderer::buildBatches(const RenderSnapshot& snapshot) {
+        const std::size_t count{snapshot.size()};
+        const dynamic::ShapeType* shape{snapshot.shape.data()};
+        const math::f32* px{snapshot.positionX.data()};
+        const math::f32* py{snapshot.positionY.data()};
+        const math::f32* radius{snapshot.radius.data()};
+        const math::f32* width{snapshot.width.data()};
+        const math::f32* height{snapshot.height.data()};
+        const auto size{static_cast<math::f32>(circleTextureSize)};
+
+        std::size_t circleCount{0};
+        std::size_t rectangleCount{0};
+        for (std::size_t i{0}; i < count; ++i) {
+            circleCount += shape[i] == dynamic::ShapeType::Circle ? 1 : 0;
+            rectangleCount += shape[i] == dynamic::ShapeType::Rectangle ? 1 : 0;
+        }
+
+        circles.resize(circleCount * 4);
+        rectangles.resize(rectangleCount * 4);
+
+        std::size_t c{0};
+        std::size_t r{0};
+        for (std::size_t i{0}; i < count; ++i) {
+            if (shape[i] == dynamic::ShapeType::Circle) {
+                const math::f32 left{px[i] - radius[i]};
+                const math::f32 top{py[i] - radius[i]};
+                const math::f32 right{px[i] + radius[i]};
+                const math::f32 bottom{py[i] + radius[i]};
+
+                circles[c++] = {{left, top}, sf::Color::Red, {0.f, 0.f}};
+                circles[c++] = {{right, top}, sf::Color::Red, {size, 0.f}};
+                circles[c++] = {{right, bottom}, sf::Color::Red, {size, size}};
+                circles[c++] = {{left, bottom}, sf::Color::Red, {0.f, size}};
+            } else if (shape[i] == dynamic::ShapeType::Rectangle) {
+                const math::f32 left{px[i] - width[i] / 2.f};
+                const math::f32 top{py[i] - height[i] / 2.f};
+                const math::f32 right{px[i] + width[i] / 2.f};
+                const math::f32 bottom{py[i] + height[i] / 2.f};
+
+                rectangles[r++] = {{left, top}, sf::Color::Blue};
+                rectangles[r++] = {{right, top}, sf::Color::Blue};
+                rectangles[r++] = {{right, bottom}, sf::Color::Blue};
+                rectangles[r++] = {{left, bottom}, sf::Color::Blue};
+            }
+        }
+    }
+
+    /**
+     * @brief Rebuilds the collider vertex arrays from the colliders in a snapshot.
+     * @param snapshot
+     *          The snapshot holding the colliders to draw.
+     */
+    void Renderer::buildColliderBatches(const RenderSnapshot& snapshot) {
+        const sf::Color color{128, 128, 128};
+        const auto size{static_cast<math::f32>(circleTextureSize)};
+
+        colliderCircles.clear();
+        colliderBoxes.clear();
+        colliderSegments.clear();
+        for (const collision::StaticShape& shape : snapshot.colliders) {
+            switch (shape.type) {
+                case collision::StaticShapeType::Segment:
+                    colliderSegments.append({{shape.x, shape.y}, color});
+                    colliderSegments.append({{shape.endX, shape.endY}, color});
+                    break;
+                case collision::StaticShapeType::Box:
+                    colliderBoxes.append({{shape.x - shape.halfWidth, shape.y - shape.halfHeight}, color});
+                    colliderBoxes.append({{shape.x + shape.halfWidth, shape.y - shape.halfHeight}, color});
+                    colliderBoxes.append({{shape.x + shape.halfWidth, shape.y + shape.halfHeight}, color});
+                    colliderBoxes.append({{shape.x - shape.halfWidth, shape.y + shape.halfHeight}, color});
+                    break;
+                case collision::StaticShapeType::Circle:
+                    colliderCircles.append({{shape.x - shape.radius, shape.y - shape.radius}, color, {0.f, 0.f}});
+                    colliderCircles.append({{shape.x + shape.radius, shape.y - shape.radius}, color, {size, 0.f}});
+                    colliderCircles.append({{shape.x + shape.radius, shape.y + shape.radius}, color, {size, size}});
+                    colliderCircles.append({{shape.x - shape.radius, shape.y + shape.radius}, color, {0.f, size}});
+                    break;
             }
         }
+        colliderRevision = snapshot.colliderRevision;
     }
-} // namespace physx::core
\ No newline at end of file
+} // namespace physx::core
@@ -0,0 +1,332 @@
+/**
+ * @file SceneLoader.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/core/SceneLoader.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace physx::core {
+    namespace {
+        /**
+         * @brief Reads a float from a whole token, so trailing characters like the @c x of @c 3x are rejected.
+         * @param token
+         *          The token to read.
+         * @param value
+         *          Receives the float.
+         * @return @c false if the token is empty or not a float.
+         */
+        bool parseFloat(const std::string& token, math::f32& value) {
+            char* end;
+            value = std::strtof(token.c_str(), &end);
+            return !token.empty() && end == token.c_str() + token.size();
+        }
+    } // namespace
+
+    /**
+     * @brief Loads a scene file into a @c Simulation.
+     * @param path
+     *          The path of the scene file.
+     * @param simulation
+     *          The @c Simulation to add the scene to.
+     * @throws except::SceneLoadException
+     *          If the file cannot be opened or contains an invalid command.
+     */
+    void SceneLoader::load(const std::string& path, Simulation& simulation) {
+        std::ifstream file{path};
+        if (!file) {
+            throw except::SceneLoadException("Cannot open scene file " + path + ".");
+        }
+
+        load(file, simulation);
+        LLOG_INFO("Loaded scene {} with {} bodies.", path, simulation.getBodies().size())
+    }
+
+    /**
+     * @brief Loads a scene description into a @c Simulation.
+     * @param input
+     *          The scene description.
+     * @param simulation
+     *          The @c Simulation to add the scene to.
+     * @throws except::SceneLoadException
+     *          If the description contains an invalid command.
+     * @throws except::SnapshotException
+     *          If a snapshot the description refers to cannot be loaded.
+     */
+    void SceneLoader::load(std::istream& input, Simulation& simulation) {
+        std::string line;
+        std::size_t lineNumber{0};
+
+        while (std::getline(input, line)) {
+            ++lineNumber;
+
+            std::istringstream stream{line};
+            std::string command;
+            if (!(stream >> command) || command[0] == '#') {
+                continue;
+            }
+
+            std::string flag;
+            bool valid{false};
+
+            if (command == "threads") {
+                std::size_t threads;
+                if ((valid = static_cast<bool>(stream >> threads))) {
+                    simulation.setThreadCount(threads);
+                }
+            } else if (command == "broadphase") {
+                std::string type;
+                stream >> type;
+                if (type == "grid") {
+                    simulation.setBroadphase(collision::BroadphaseType::UniformGrid);
+                    valid = true;
+                } else if (type == "tree") {
+                    simulation.setBroadphase(collision::BroadphaseType::AABBTree);
+                    valid = true;
+                } else if (type == "sap") {
+                    simulation.setBroadphase(collision::BroadphaseType::SweepAndPrune);
+                    valid = true;
+                }
+            } else if (command == "solver") {
+                std::string type;
+                std::size_t iterations;
+                if (stream >> type >> iterations && (type == "gs" || type == "jacobi")) {
+                    simulation.setSolver(type == "gs" ? collision::SolverType::GaussSeidel
+                                                      : collision::SolverType::Jacobi, iterations);
+                    valid = true;
+                }
+            } else if (command == "correction") {
+                std::string type;
+                math::f32 factor;
+                if (stream >> type >> factor && (type == "baumgarte" || type == "split")) {
+                    simulation.setPositionCorrection(type == "baumgarte" ? collision::PositionCorrection::Baumgarte
+                                                                         : collision::PositionCorrection::SplitImpulse,
+                                                     factor);
+                    valid = true;
+                }
+            } else if (command == "sleep") {
+                std::string setting;
+                math::f32 speed;
+                std::uint16_t steps;
+                stream >> setting;
+                if (setting == "off") {
+                    simulation.setSleepEnabled(false);
+                    valid = true;
+                } else if (setting == "on") {
+                    simulation.setSleepEnabled(true);
+                    valid = true;
+                } else if ((valid = parseFloat(setting, speed) && speed > 0.f && stream >> steps)) {
+                    simulation.setSleepEnabled(true);
+                    simulation.setSleepThreshold(speed, steps);
+                }
+            } else if (command == "boundary") {
+                std::string setting;
+                math::f32 radius, x, y;
+                stream >> setting;
+                if (setting == "off") {
+                    simulation.setBoundary(simulation.getConstraintCenter(), 0.f);
+                    valid = true;
+                } else if ((valid = parseFloat(setting, radius) && radius > 0.f && stream >> x >> y)) {
+                    simulation.setBoundary({x, y}, radius);
+                }
+            } else if (command == "collider") {
+                valid = addCollider(stream, simulation.getColliders());
+            } else if (command == "snapshot") {
+                std::string snapshotPath;
+                if ((valid = static_cast<bool>(stream >> snapshotPath))) {
+                    simulation.loadSnapshot(snapshotPath);
+                }
+            } else if (command == "circle") {
+                math::f32 radius, x, y;
+                if ((valid = static_cast<bool>(stream >> radius >> x >> y))) {
+                    stream >> flag;
+                    simulation.addCircleObject(radius, {x, y}, flag != "static");
+                }
+            } else if (command == "rectangle") {
+                math::f32 width, height, x, y;
+                if ((valid = static_cast<bool>(stream >> width >> height >> x >> y))) {
+                    stream >> flag;
+                    simulation.addRectangleObject(width, height, {x, y}, flag != "static");
+                }
+            } else if (command == "joint") {
+                std::size_t a, b;
+                math::f32 length{-1.f};
+                if ((valid = static_cast<bool>(stream >> a >> b) && isBody(simulation, a) && isBody(simulation, b))) {
+                    stream >> length;
+                    simulation.addDistanceJoint(getObject(simulation, a), getObject(simulation, b), length);
+                }
+            } else if (command == "spring") {
+                std::size_t a, b;
+                math::f32 stiffness, damping, length{-1.f};
+                if ((valid = static_cast<bool>(stream >> a >> b >> stiffness >> damping) && isBody(simulation, a) &&
+                             isBody(simulation, b))) {
+                    stream >> length;
+                    simulation.addSpring(getObject(simulation, a), getObject(simulation, b), stiffness, damping,
+                                         length);
+                }
+            } else if (command == "pin") {
+                std::size_t object;
+                math::f32 x, y, length{0.f};
+                if ((valid = static_cast<bool>(stream >> object >> x >> y) && isBody(simulation, object))) {
+                    stream >> length;
+                    simulation.addPin(getObject(simulation, object), {x, y}, length);
+                }
+            } else if (command == "rope") {
+                std::size_t links;
+                math::f32 radius, x, y;
+                if ((valid = static_cast<bool>(stream >> links >> radius >> x >> y) && links > 0 && radius > 0.f)) {
+                    rope(simulation, links, radius, {x, y});
+                }
+            } else if (command == "fill") {
+                std::size_t count;
+                math::f32 radius;
+                if ((valid = static_cast<bool>(stream >> count >> radius) && radius > 0.f)) {
+                    fill(simulation, count, radius);
+                }
+            }
+
+            if (!valid) {
+                throw except::SceneLoadException("Invalid scene command on line " + std::to_string(lineNumber) +
+                                                 ": " + line);
+            }
+        }
+    }
+
+    /**
+     * @brief Adds the collider described by the rest of a @c collider command.
+     * @param stream
+     *          The command, positioned after @c collider.
+     * @param colliders
+     *          The colliders to add to.
+     * @return False if the description is invalid, in which case nothing is added.
+     */
+    bool SceneLoader::addCollider(std::istringstream& stream, collision::StaticWorld& colliders) {
+        std::string type;
+        stream >> type;
+        if (type == "segment") {
+            math::f32 x0, y0, x1, y1;
+            if (stream >> x0 >> y0 >> x1 >> y1) {
+                colliders.addSegment({x0, y0}, {x1, y1});
+                return true;
+            }
+        } else if (type == "box") {
+            math::f32 width, height, x, y;
+            if (stream >> width >> height >> x >> y && width > 0.f && height > 0.f) {
+                colliders.addBox({x, y}, width, height);
+                return true;
+            }
+        } else if (type == "circle") {
+            math::f32 radius, x, y;
+            if (stream >> radius >> x >> y && radius > 0.f) {
+                colliders.addCircle({x, y}, radius);
+                return true;
+            }
+        } else if (type == "polyline") {
+            std::string closure;
+            stream >> closure;
+            std::vector<math::f32> values;
+            math::f32 value;
+            while (stream >> value) {
+                values.push_back(value);
+            }
+            if ((closure == "open" || closure == "closed") && stream.eof() && values.size() >= 4 &&
+                values.size() % 2 == 0) {
+                std::vector<math::Vec2f> points;
+                for (std::size_t i{0}; i < values.size(); i += 2) {
+                    points.emplace_back(values[i], values[i + 1]);
+                }
+                colliders.addPolyline(points, closure == "closed");
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Hangs a horizontal chain of circles joined by distance joints, pinning the first link where it is.
+     * @param simulation
+     *          The @c Simulation to add the rope to.
+     * @param links
+     *          The number of circles.
+     * @param radius
+     *          The radius of each circle.
+     * @param start
+     *          The center of the first circle.
+     */
+    void SceneLoader::rope(Simulation& simulation, std::size_t links, math::f32 radius, const math::Vec2f& start) {
+        const math::f32 spacing{2.f * radius};
+
+        object::Circle2D previous{simulation.addCircleObject(radius, start, true)};
+        simulation.addPin(previous, start);
+        for (std::size_t i{1}; i < links; ++i) {
+            const object::Circle2D link{simulation.addCircleObject(
+                    radius, {start.getX() + spacing * static_cast<math::f32>(i), start.getY()}, true)};
+            simulation.addDistanceJoint(previous, link, spacing);
+            previous = link;
+        }
+    }
+
+    /**
+     * @brief Checks whether a scene command refers to a body that exists.
+     * @param simulation
+     *          The @c Simulation being loaded.
+     * @param index
+     *          The index from the command.
+     * @return True if the index is in range.
+     */
+    bool SceneLoader::isBody(Simulation& simulation, std::size_t index) {
+        return index < simulation.getBodies().size();
+    }
+
+    /**
+     * @brief Gets a handle to a body by the index a scene command gives it.
+     * @param simulation
+     *          The @c Simulation being loaded.
+     * @param index
+     *          The index of the body.
+     * @return The handle.
+     */
+    object::Object2D SceneLoader::getObject(Simulation& simulation, std::size_t index) {
+        return object::Object2D{&simulation.getBodies(), index};
+    }
+
+    /**
+     * @brief Packs circles on a square lattice into the circular boundary, starting from the bottom.
+     * @param simulation
+     *          The @c Simulation to add the circles to.
+     * @param count
+     *          The number of circles.
+     * @param radius
+     *          The radius of each circle.
+     * @throws except::SceneLoadException
+     *          If the circles do not fit inside the boundary.
+     */
+    void SceneLoader::fill(Simulation& simulation, std::size_t count, math::f32 radius) {
+        const math::Vec2f& center{simulation.getConstraintCenter()};
+        const math::f32 limit{simulation.getConstraintRadius() - radius};
+        const math::f32 spacing{2.1f * radius};
+
+        simulation.getBodies().reserve(simulation.getBodies().size() + count);
+
+        std::size_t added{0};
+        for (math::f32 dy{limit}; dy >= -limit && added < count; dy -= spacing) {
+            const math::f32 halfChord{std::sqrt(limit * limit - dy * dy)};
+            for (math::f32 dx{-halfChord}; dx <= halfChord && added < count; dx += spacing) {
+                simulation.addCircleObject(radius, {center.getX() + dx, center.getY() + dy}, true);
+                ++added;
+            }
+        }
+
+        if (added < count) {
+            throw except::SceneLoadException("Cannot fit " + std::to_string(count) + " circles of radius " +
+                                             std::to_string(radius) + " inside the boundary.");
+        }
+    }
+} // namespace physx::core
@@ -7,35 +7,65 @@
 
 #include "../../include/physx/core/Simulation.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "../../include/physx/collision/Narrowphase.hpp"
+
 namespace physx::core {
+    /**
+     * @brief Narrowphase handlers indexed by the shape of the first and second body, in the order Circle,
+     * Rectangle, None.
+     */
+    const Simulation::CollisionHandler
+    Simulation::collisionHandlers[dynamic::shapeTypeCount][dynamic::shapeTypeCount]{
+            {&Simulation::collideCircles, &Simulation::collideCircleRectangle, nullptr},
+            {&Simulation::collideRectangleCircle, &Simulation::collideRectangles, nullptr},
+            {nullptr, nullptr, nullptr}
+    };
 
     /**
      * @brief @c Simulation constructor.
      */
-    Simulation::Simulation() {
+    Simulation::Simulation()
+        : grid{constraintCenter - constraintRadius, constraintCenter + constraintRadius},
+          threadPool{std::make_unique<utils::ThreadPool>(1)} {
         utils::configureLLOG();
         LLOG_DEBUG("Simulation created.")
     }
 
     /**
-     * @brief @c Simulation destructor.
+     * @brief Advances the simulation by one step.
+     *
+     * Stepping only touches the simulation state, so it can run without a window or any input devices.
+     * @param dt
+     *          The time step.
      */
-    Simulation::~Simulation() {
-        // BREAKING SIMULATION
+    void Simulation::update(math::f32 dt) {
+        {
+            PHYSX_PROFILE_SCOPE(profiler, utils::ProfilePhase::Step);
+            PHYSX_TRACE_SCOPE(tracer, utils::ProfilePhase::Step);
+            updatePositions(dt);
+            applyConstraints();
+            applyGravity();
+            checkCollisions(dt);
+            solveConstraints(dt);
+            updateSleep(dt);
+        }
 
-//        if (!objects.empty()) {
-//            for (auto* obj : objects) {
-//                delete obj;
-//            }
-//        }
+        PHYSX_PROFILE_COUNT(profiler, utils::ProfileCounter::SleepingBodies, bodies.getSleepingCount());
+        PHYSX_PROFILE_END_STEP(profiler);
+        ++stepCount;
+        PHYSX_TRACE(tracer.setStep(stepCount));
     }
 
-    void Simulation::update(math::f32 dt) {
-        checkForMouseEvents();
-        updatePositions(dt);
-        applyConstraints();
-        applyGravity();
-        checkCollisions(dt);
+    /**
+     * @brief Gets the number of steps run so far, which is also the number of the next step.
+     * @return The step count.
+     */
+    std::uint64_t Simulation::getStepCount() const {
+        return stepCount;
     }
 
     /**
@@ -48,11 +78,15 @@ namespace physx::core {
      *          Whether the circle has a @c RigidBody2D or not.
      * @param integrationType
      *          The numerical integration the @c RigidBody2D should use.
+     * @return A handle to the new circle.
      */
-    void Simulation::addCircleObject(math::f32 radius, const math::Vec2f& position, bool rb,
-                                     dynamic::IntegrationType integrationType) {
-        objects.emplace_back(new object::Circle2D{radius, position, rb});
-        LLOG_DEBUG("Added Circle2D object to simulation @ pos {}.", position.toString())
+    object::Circle2D Simulation::addCircleObject(math::f32 radius, const math::Vec2f& position, bool rb,
+                                                 dynamic::IntegrationType integrationType) {
+        std::size_t index{bodies.add(dynamic::ShapeType::Circle, position, radius, 0.f, 0.f, mass, rb,
+                                     integrationType)};
+        PHYSX_TRACE(tracer.spawn(index, static_cast<std::uint8_t>(dynamic::ShapeType::Circle), position.getX(),
+                                 position.getY()));
+        return {&bodies, index};
     }
 
     /**
@@ -67,180 +101,1767 @@ namespace physx::core {
      *          Whether the rectangle has a @c RigidBody2D or not.
      * @param integrationType
      *          The numerical integration the @c RigidBody2D should use.
+     * @return A handle to the new rectangle.
+     */
+    object::Rectangle2D Simulation::addRectangleObject(float width, float height, const math::Vec2f& position, bool rb,
+                                                       dynamic::IntegrationType integrationType) {
+        std::size_t index{bodies.add(dynamic::ShapeType::Rectangle, position, 0.f, width, height, mass, rb,
+                                     integrationType)};
+        PHYSX_TRACE(tracer.spawn(index, static_cast<std::uint8_t>(dynamic::ShapeType::Rectangle), position.getX(),
+                                 position.getY()));
+        return {&bodies, index};
+    }
+
+    /**
+     * @brief Removes an object from the simulation. Its slot is reused by the next object added.
+     * @param object
+     *          A handle to the object to remove.
+     */
+    void Simulation::removeObject(const object::Object2D& object) {
+        bodies.remove(object.getIndex());
+        joints.removeBody(static_cast<std::uint32_t>(object.getIndex()));
+        contactCache.removeBody(static_cast<std::uint32_t>(object.getIndex()));
+        PHYSX_TRACE(tracer.remove(object.getIndex()));
+    }
+
+    /**
+     * @brief Joins two objects with a rigid rod that keeps them at a fixed distance.
+     * @param a
+     *          The first object.
+     * @param b
+     *          The second object.
+     * @param length
+     *          The distance to keep, or negative for their current distance.
+     * @return The index of the joint.
+     */
+    std::size_t Simulation::addDistanceJoint(const object::Object2D& a, const object::Object2D& b, math::f32 length) {
+        return addJoint(dynamic::ConstraintType::Distance, a.getIndex(), b.getIndex(), length, 0.f, 0.f);
+    }
+
+    /**
+     * @brief Joins two objects with a damped spring.
+     * @param a
+     *          The first object.
+     * @param b
+     *          The second object.
+     * @param stiffness
+     *          The force per unit of stretch.
+     * @param damping
+     *          The force per unit of stretching speed.
+     * @param length
+     *          The rest length, or negative for their current distance.
+     * @return The index of the joint.
      */
-    void Simulation::addRectangleObject(float width, float height, const math::Vec2f& position, bool rb,
-                                        dynamic::IntegrationType integrationType) {
-        objects.emplace_back(new object::Rectangle2D{width, height, position, rb});
-        LLOG_DEBUG("Added Rectangle2D object to simulation @ pos {}.", position.toString())
+    std::size_t Simulation::addSpring(const object::Object2D& a, const object::Object2D& b, math::f32 stiffness,
+                                      math::f32 damping, math::f32 length) {
+        return addJoint(dynamic::ConstraintType::Spring, a.getIndex(), b.getIndex(), length, stiffness, damping);
     }
 
     /**
-     * @brief Adds an object to the simulation.
-     * @param obj
-     *          The object to add.
+     * @brief Pins an object to a point in the world.
+     * @param object
+     *          The object.
+     * @param anchor
+     *          The point.
+     * @param length
+     *          The distance to keep from the point, zero to hold the object in place.
+     * @return The index of the joint.
      */
-    void Simulation::addObject(object::Object2D* obj) {
-        objects.emplace_back(obj);
+    std::size_t Simulation::addPin(const object::Object2D& object, const math::Vec2f& anchor, math::f32 length) {
+        bodies.wake(object.getIndex());
+        return joints.add(dynamic::ConstraintType::Pin, static_cast<std::uint32_t>(object.getIndex()),
+                          dynamic::ConstraintStore::noBody, length, 0.f, 0.f, anchor.getX(), anchor.getY());
     }
 
     /**
-     * @brief Gets all the objects in the simulation.
+     * @brief Gets handles to all the objects in the simulation.
      * @return All the objects in the simulation.
      */
-    std::vector<object::Object2D*> Simulation::getObjects() {
+    std::vector<object::Object2D> Simulation::getObjects() {
+        const dynamic::ShapeType* shape{bodies.getShape()};
+
+        std::vector<object::Object2D> objects;
+        objects.reserve(bodies.size() - bodies.getFreeCount());
+        for (std::size_t i{0}; i < bodies.size(); ++i) {
+            if (shape[i] != dynamic::ShapeType::None) {
+                objects.emplace_back(&bodies, i);
+            }
+        }
         return objects;
     }
 
-    void Simulation::checkForMouseEvents() {
-        static bool pressed{false};
+    /**
+     * @brief Gets the per-phase timings and counters of recent steps. Only filled in when built with
+     * @c PHYSX_PROFILING.
+     * @return The @c Profiler.
+     */
+    utils::Profiler& Simulation::getProfiler() {
+        return profiler;
+    }
+
+    /**
+     * @brief Gets the per-phase timings and counters of recent steps. Only filled in when built with
+     * @c PHYSX_PROFILING.
+     * @return The @c Profiler.
+     */
+    const utils::Profiler& Simulation::getProfiler() const {
+        return profiler;
+    }
+
+    /**
+     * @brief Gets the trace of recent spawns, collisions, phases and constraint clamps. Only filled in when built
+     * with @c PHYSX_TRACING.
+     * @return The @c Tracer.
+     */
+    utils::Tracer& Simulation::getTracer() {
+        return tracer;
+    }
+
+    /**
+     * @brief Gets the trace of recent spawns, collisions, phases and constraint clamps. Only filled in when built
+     * with @c PHYSX_TRACING.
+     * @return The @c Tracer.
+     */
+    const utils::Tracer& Simulation::getTracer() const {
+        return tracer;
+    }
+
+    /**
+     * @brief Gets the @c BodyStore holding every body in the simulation.
+     * @return The @c BodyStore.
+     */
+    dynamic::BodyStore& Simulation::getBodies() {
+        return bodies;
+    }
+
+    /**
+     * @brief Gets the @c BodyStore holding every body in the simulation.
+     * @return The @c BodyStore.
+     */
+    const dynamic::BodyStore& Simulation::getBodies() const {
+        return bodies;
+    }
+
+    /**
+     * @brief Gets the joints between the bodies.
+     * @return The joints.
+     */
+    dynamic::ConstraintStore& Simulation::getJoints() {
+        return joints;
+    }
+
+    /**
+     * @brief Gets the joints between the bodies.
+     * @return The joints.
+     */
+    const dynamic::ConstraintStore& Simulation::getJoints() const {
+        return joints;
+    }
+
+    /**
+     * @brief Gets the static level geometry. Shapes added to it take effect from the next step.
+     * @return The colliders.
+     */
+    collision::StaticWorld& Simulation::getColliders() {
+        return colliders;
+    }
+
+    /**
+     * @brief Gets the static level geometry.
+     * @return The colliders.
+     */
+    const collision::StaticWorld& Simulation::getColliders() const {
+        return colliders;
+    }
 
-        ///< Adding a Circle2D at the position of the mouse when the left button is pressed.
-        if (utils::Mouse::mousePressed(sf::Mouse::Left) && !pressed) {
-            pressed = true;
-            addCircleObject(20.f, utils::Mouse::getRelativePosition(), true);
+    /**
+     * @brief Saves the state of every body to a binary snapshot, see @c dynamic::BodyStore::saveSnapshot.
+     * @param path
+     *          The path of the snapshot file.
+     * @throws except::SnapshotException
+     *          If the file cannot be written.
+     */
+    void Simulation::saveSnapshot(const std::string& path) const {
+        bodies.saveSnapshot(path);
+        LLOG_DEBUG("Saved snapshot {} with {} bodies.", path, bodies.size())
+    }
+
+    /**
+     * @brief Replaces every body with the bodies of a snapshot. Handles to the previous bodies must not be used
+     * afterwards.
+     *
+     * Snapshots hold bodies only, so every joint, spring and pin is dropped, since their bodies are gone. Ones the
+     * loaded bodies need have to be added again.
+     * @param path
+     *          The path of the snapshot file.
+     * @throws except::SnapshotException
+     *          If the file cannot be read or is not a compatible snapshot.
+     */
+    void Simulation::loadSnapshot(const std::string& path) {
+        bodies.loadSnapshot(path);
+        tree.clear();
+        sweepAndPrune.clear();
+        contactCache.clear();
+        joints.clear();
+        LLOG_DEBUG("Loaded snapshot {} with {} bodies.", path, bodies.size())
+    }
+
+    /**
+     * @brief Sets the number of threads used to resolve collisions.
+     * @param threadCount
+     *          The number of threads, including the one calling @c update.
+     */
+    void Simulation::setThreadCount(std::size_t threadCount) {
+        threadPool = std::make_unique<utils::ThreadPool>(threadCount);
+        profiler.setThreadCount(threadPool->getThreadCount());
+        tracer.setThreadCount(threadPool->getThreadCount());
+        LLOG_DEBUG("Simulation using {} threads.", threadPool->getThreadCount())
+    }
+
+    /**
+     * @brief Gets the number of threads used to resolve collisions.
+     * @return The thread count.
+     */
+    std::size_t Simulation::getThreadCount() const {
+        return threadPool->getThreadCount();
+    }
+
+    /**
+     * @brief Sets the broadphase used to find candidate collision pairs.
+     * @param type
+     *          The broadphase.
+     */
+    void Simulation::setBroadphase(collision::BroadphaseType type) {
+        broadphase = type;
+        tree.clear();
+        sweepAndPrune.clear();
+        LLOG_DEBUG("Simulation using broadphase {}.", static_cast<int>(type))
+    }
+
+    /**
+     * @brief Gets the broadphase used to find candidate collision pairs.
+     * @return The broadphase.
+     */
+    collision::BroadphaseType Simulation::getBroadphase() const {
+        return broadphase;
+    }
+
+    /**
+     * @brief Enables or disables putting resting islands of bodies to sleep. Disabling wakes every body.
+     * @param enabled
+     *          Whether bodies may sleep.
+     */
+    void Simulation::setSleepEnabled(bool enabled) {
+        sleepEnabled = enabled;
+        if (!enabled) {
+            for (std::size_t i{0}; i < bodies.size(); ++i) {
+                bodies.wake(i);
+            }
         }
+    }
+
+    /**
+     * @brief Sets when an island of bodies is put to sleep.
+     * @param speed
+     *          The speed below which a body counts as resting.
+     * @param steps
+     *          The number of consecutive steps every body of an island has to rest before the island sleeps.
+     */
+    void Simulation::setSleepThreshold(math::f32 speed, std::uint16_t steps) {
+        sleepSpeed = speed;
+        sleepSteps = std::max<std::uint16_t>(steps, 1);
+    }
+
+    /**
+     * @brief Gets whether resting islands of bodies are put to sleep.
+     * @return @c true if bodies may sleep.
+     */
+    bool Simulation::isSleepEnabled() const {
+        return sleepEnabled;
+    }
+
+    /**
+     * @brief Gets the number of sleeping bodies.
+     * @return The number of sleeping bodies.
+     */
+    std::size_t Simulation::getSleepingCount() const {
+        return bodies.getSleepingCount();
+    }
 
-        if (!utils::Mouse::mousePressed(sf::Mouse::Left)) {
-            pressed = false;
+    /**
+     * @brief Enables or disables starting the solver from the impulses each touching pair took last step.
+     * Disabling drops the cached impulses.
+     * @param enabled
+     *          Whether to warm start.
+     */
+    void Simulation::setWarmStartEnabled(bool enabled) {
+        warmStartEnabled = enabled;
+        if (!enabled) {
+            contactCache.clear();
         }
     }
 
+    /**
+     * @brief Gets whether the solver starts from the impulses each touching pair took last step.
+     * @return @c true if warm starting.
+     */
+    bool Simulation::isWarmStartEnabled() const {
+        return warmStartEnabled;
+    }
+
+    /**
+     * @brief Sets how the contacts are solved.
+     * @param type
+     *          Whether to solve contacts one after another or all at once on the thread pool.
+     * @param iterations
+     *          The number of passes over the contacts each step, at least one. More passes settle stacks better.
+     */
+    void Simulation::setSolver(collision::SolverType type, std::size_t iterations) {
+        solver = type;
+        solverIterations = std::max<std::size_t>(iterations, 1);
+    }
+
+    /**
+     * @brief Gets how the contacts are solved.
+     * @return The solver type.
+     */
+    collision::SolverType Simulation::getSolver() const {
+        return solver;
+    }
+
+    /**
+     * @brief Gets the number of passes over the contacts each step.
+     * @return The iteration count.
+     */
+    std::size_t Simulation::getSolverIterations() const {
+        return solverIterations;
+    }
+
+    /**
+     * @brief Sets how the overlap of touching bodies is removed.
+     * @param type
+     *          The kind of correction.
+     * @param factor
+     *          The share of the overlap removed, per step for Baumgarte (around 0.2) or per pass for split impulses
+     *          (around 0.8).
+     */
+    void Simulation::setPositionCorrection(collision::PositionCorrection type, math::f32 factor) {
+        positionCorrection = type;
+        correctionFactor = std::clamp(factor, 0.f, 1.f);
+    }
+
+    /**
+     * @brief Gets how the overlap of touching bodies is removed.
+     * @return The kind of correction.
+     */
+    collision::PositionCorrection Simulation::getPositionCorrection() const {
+        return positionCorrection;
+    }
+
+    /**
+     * @brief Sets the circle every body is kept inside.
+     * @param center
+     *          The center of the boundary.
+     * @param radius
+     *          The radius of the boundary, or zero to leave the bodies free apart from the colliders.
+     */
+    void Simulation::setBoundary(const math::Vec2f& center, math::f32 radius) {
+        constraintCenter = center;
+        constraintRadius = std::max(radius, 0.f);
+        updateGridBounds();
+    }
+
+    /**
+     * @brief Checks whether the bodies are kept inside a circular boundary.
+     * @return True if there is a boundary.
+     */
+    bool Simulation::hasBoundary() const {
+        return constraintRadius > 0.f;
+    }
+
+    /**
+     * @brief Gets the center of the circular boundary.
+     * @return The center.
+     */
+    const math::Vec2f& Simulation::getConstraintCenter() const {
+        return constraintCenter;
+    }
+
+    /**
+     * @brief Gets the radius of the circular boundary.
+     * @return The radius.
+     */
+    math::f32 Simulation::getConstraintRadius() const {
+        return constraintRadius;
+    }
+
+    /**
+     * @brief Integrates every body with a rigid body.
+     *
+     * Each integration type that is in use gets one pass of its batched kernel over the body arrays, which only
+     * touches the bodies in that group.
+     * @param dt
+     *          The time step.
+     */
     void Simulation::updatePositions(math::f32 dt) {
-        for (auto& obj : objects) {
-            if (obj->isRbEnabled()) {
-                obj->update(dt);
+        PHYSX_PROFILE_SCOPE(profiler, utils::ProfilePhase::Integrate);
+        PHYSX_TRACE_SCOPE(tracer, utils::ProfilePhase::Integrate);
+
+        auto integrateGroup = [this, dt](auto integrator) {
+            using Integrator = decltype(integrator);
+            if (bodies.getIntegrationCount(Integrator::type) == 0) {
+                return;
             }
-        }
+            PHYSX_PROFILE_COUNT(profiler, utils::ProfileCounter::BodiesIntegrated,
+                                bodies.getIntegrationCount(Integrator::type));
+
+            utils::batch::integrate<Integrator>(bodies.getPositionX(), bodies.getPositionY(),
+                                                bodies.getPositionOldX(), bodies.getPositionOldY(),
+                                                bodies.getVelocityX(), bodies.getVelocityY(),
+                                                bodies.getAccelerationX(), bodies.getAccelerationY(),
+                                                bodies.getIntegrationGroups(), bodies.size(), dt);
+        };
+
+        integrateGroup(dynamic::EulerIntegrator{});
+        integrateGroup(dynamic::VerletIntegrator{});
+        integrateGroup(dynamic::RK4Integrator{});
     }
 
+    /**
+     * @brief Accelerates every awake body with a rigid body by gravity.
+     */
     void Simulation::applyGravity() {
-        // For each object in the simulation -> accelerate
-        for (auto& obj : objects) {
-            if (obj->isRbEnabled()) {
-                obj->getRb()->accelerate(gravity);
-            }
-        }
+        PHYSX_PROFILE_SCOPE(profiler, utils::ProfilePhase::Gravity);
+        PHYSX_TRACE_SCOPE(tracer, utils::ProfilePhase::Gravity);
+        utils::batch::accelerate(bodies.getAccelerationX(), bodies.getAccelerationY(), bodies.getIntegrationGroups(),
+                                 bodies.size(), gravity.getX(), gravity.getY());
     }
 
+    /**
+     * @brief Keeps every body inside the circular boundary and out of the colliders.
+     *
+     * The colliders are indexed the first time a step runs after they change, see @c constrainToColliders. The
+     * batch kernel keeps each circle its radius away from the edge. A rectangle only keeps half its shorter
+     * side, which never holds it further in than its corners allow, and is then fitted by @c constrainRectangles.
+     * The batch kernel does not report which bodies it moved, so while tracing the circles about to be clamped are
+     * found with a scalar pass first. Rectangles are only traced by @c constrainRectangles, against their corners.
+     * Clamping only moves the position, so bodies with a stored velocity are stopped first, see @c stopAtBoundary.
+     */
     void Simulation::applyConstraints() {
-        for (auto& obj : objects) {
-            auto cast{dynamic_cast<object::Circle2D*>(obj)};
-            if (cast) {
-                math::Vec2f v{math::Vec2f{500.f, 500.f} - obj->getRb()->getPosition()};
-                math::f32 distance{utils::length(v)};
-
-                if (distance > (450.f - cast->getRadius())) {
-                    math::Vec2f n{v / distance};
-                    obj->getRb()->setPosition(math::Vec2f{500.f, 500.f} - n * (450.f - cast->getRadius()));
+        PHYSX_PROFILE_SCOPE(profiler, utils::ProfilePhase::Constraints);
+        PHYSX_TRACE_SCOPE(tracer, utils::ProfilePhase::Constraints);
+#if defined(PHYSX_TRACING)
+        if (tracer.isEnabled() && hasBoundary()) {
+            const math::f32* px{bodies.getPositionX()};
+            const math::f32* py{bodies.getPositionY()};
+            const math::f32* extent{bodies.getExtent()};
+            const dynamic::ShapeType* shape{bodies.getShape()};
+            for (std::size_t i{0}; i < bodies.size(); ++i) {
+                if (shape[i] != dynamic::ShapeType::Circle) {
+                    continue;
                 }
-            } else {
-                auto cast1 = dynamic_cast<object::Rectangle2D*>(obj);
-                math::Vec2f v{math::Vec2f{500.f, 500.f} - obj->getRb()->getPosition()};
-                float distance{utils::length(v)};
 
-                if (distance > (450.f - cast1->getWidth())) {
-                    math::Vec2f n{v / distance};
-                    obj->getRb()->setPosition(math::Vec2f{500.f, 500.f} - n * (450.f - cast1->getWidth()));
+                const math::f32 dx{px[i] - constraintCenter.getX()};
+                const math::f32 dy{py[i] - constraintCenter.getY()};
+                const math::f32 limit{constraintRadius - extent[i]};
+                if (dx * dx + dy * dy > limit * limit) {
+                    tracer.constraintClamp(i, std::sqrt(dx * dx + dy * dy) - limit);
                 }
             }
         }
+#endif
+        if (!colliders.isBuilt()) {
+            colliders.build();
+            updateGridBounds();
+        }
+
+        if (hasBoundary()) {
+            if (bodies.getIntegrationCount(dynamic::IntegrationType::Euler) > 0 ||
+                bodies.getIntegrationCount(dynamic::IntegrationType::RK4) > 0) {
+                stopAtBoundary();
+            }
+
+            utils::batch::constrainToCircle(bodies.getPositionX(), bodies.getPositionY(), bodies.getExtent(),
+                                            bodies.size(), constraintCenter.getX(), constraintCenter.getY(),
+                                            constraintRadius);
+
+            if (bodies.getShapeCount(dynamic::ShapeType::Rectangle) > 0) {
+                constrainRectangles();
+            }
+        }
+
+        if (!colliders.isEmpty()) {
+            constrainToColliders();
+        }
     }
 
+    /**
+     * @brief Takes away the outward speed of every body that keeps a stored velocity and is about to be clamped to
+     * the boundary.
+     *
+     * Moving a Verlet body also moves its velocity, but Euler and RK4 bodies keep theirs, so without this a body
+     * resting on the boundary gains the speed gravity adds every step and never gives it back.
+     */
+    void Simulation::stopAtBoundary() {
+        const std::uint8_t* groups{bodies.getIntegrationGroups()};
+        constexpr std::uint8_t storedVelocity{dynamic::integrationGroup(dynamic::IntegrationType::Euler) |
+                                              dynamic::integrationGroup(dynamic::IntegrationType::RK4)};
+
+        for (std::size_t i{0}; i < bodies.size(); ++i) {
+            math::Vec2f normal;
+            if ((groups[i] & storedVelocity) != 0 && getBoundaryGap(i, normal) > 0.f) {
+                stopStoredVelocity(i, normal);
+            }
+        }
+    }
+
+    /**
+     * @brief Gets how far a body reaches past the boundary. A circle is measured by its radius, like the batch
+     * kernel measures it, and a rectangle by its farthest corner from the center, like @c constrainRectangles.
+     * @param index
+     *          The index of the body.
+     * @param normal
+     *          Receives the unit normal pointing out of the boundary at the body.
+     * @return The distance past the boundary, negative while the body is inside it.
+     */
+    math::f32 Simulation::getBoundaryGap(std::size_t index, math::Vec2f& normal) const {
+        math::f32 dx{bodies.getPositionX()[index] - constraintCenter.getX()};
+        math::f32 dy{bodies.getPositionY()[index] - constraintCenter.getY()};
+        math::f32 limit{constraintRadius - bodies.getExtent()[index]};
+        if (bodies.getShape()[index] == dynamic::ShapeType::Rectangle) {
+            dx += std::copysign(bodies.getWidth()[index] / 2.f, dx);
+            dy += std::copysign(bodies.getHeight()[index] / 2.f, dy);
+            limit = constraintRadius;
+        }
+
+        const math::f32 distance{std::sqrt(dx * dx + dy * dy)};
+        if (distance == 0.f) {
+            normal = {};
+            return -limit;
+        }
+        normal = {dx / distance, dy / distance};
+        return distance - limit;
+    }
+
+    /**
+     * @brief Moves every rectangle whose farthest corner from the center is outside the boundary towards the
+     * center, until that corner lies on the boundary.
+     */
+    void Simulation::constrainRectangles() {
+        const std::size_t count{bodies.size()};
+        const dynamic::ShapeType* shape{bodies.getShape()};
+        math::f32* px{bodies.getPositionX()};
+        math::f32* py{bodies.getPositionY()};
+        const math::f32* width{bodies.getWidth()};
+        const math::f32* height{bodies.getHeight()};
+
+        for (std::size_t i{0}; i < count; ++i) {
+            if (shape[i] != dynamic::ShapeType::Rectangle) {
+                continue;
+            }
+
+            const math::f32 dx{px[i] - constraintCenter.getX()};
+            const math::f32 dy{py[i] - constraintCenter.getY()};
+            const math::f32 cornerX{dx + std::copysign(width[i] / 2.f, dx)};
+            const math::f32 cornerY{dy + std::copysign(height[i] / 2.f, dy)};
+            const math::f32 distance{std::sqrt(cornerX * cornerX + cornerY * cornerY)};
+            if (distance <= constraintRadius) {
+                continue;
+            }
+
+            PHYSX_TRACE(tracer.constraintClamp(i, distance - constraintRadius));
+            const math::f32 scale{constraintRadius / distance};
+            px[i] += cornerX * scale - cornerX;
+            py[i] += cornerY * scale - cornerY;
+        }
+    }
+
+    /**
+     * @brief Pushes every moving body out of the colliders it overlaps.
+     *
+     * Each body only tests the shapes the collider hierarchy returns for its bounds, so the cost per body grows
+     * with the log of the shape count rather than with the shape count. A body is pushed out of one shape at a
+     * time, in a fixed order, and only its own position changes, so the bodies are split across the thread pool.
+     * The push only moves the position, which for Verlet bodies also takes away the speed into the shape, while
+     * bodies with a stored velocity lose it through @c stopStoredVelocity. Segments have no thickness, so they are
+     * also tested against the path of the body over the step, see @c sweepSegment.
+     */
+    void Simulation::constrainToColliders() {
+        threadPool->parallelFor(bodies.size(), [this](std::size_t begin, std::size_t end) {
+            const std::uint8_t* groups{bodies.getIntegrationGroups()};
+            const dynamic::ShapeType* shape{bodies.getShape()};
+            math::f32* px{bodies.getPositionX()};
+            math::f32* py{bodies.getPositionY()};
+            const math::f32* radius{bodies.getRadius()};
+            const math::f32* width{bodies.getWidth()};
+            const math::f32* height{bodies.getHeight()};
+
+            for (std::size_t i{begin}; i < end; ++i) {
+                if (groups[i] == 0) {
+                    continue;
+                }
+
+                const bool circle{shape[i] == dynamic::ShapeType::Circle};
+                const math::f32 halfWidth{circle ? radius[i] : width[i] / 2.f};
+                const math::f32 halfHeight{circle ? radius[i] : height[i] / 2.f};
+                // Every integrator leaves the position the body started the step at in positionOld
+                const math::Vec2f previous{bodies.getPositionOldX()[i], bodies.getPositionOldY()[i]};
+                const collision::AABB box{std::min(px[i], previous.getX()) - halfWidth,
+                                          std::min(py[i], previous.getY()) - halfHeight,
+                                          std::max(px[i], previous.getX()) + halfWidth,
+                                          std::max(py[i], previous.getY()) + halfHeight};
+                colliders.query(box, [&](const collision::StaticShape& collider) {
+                    collision::Contact contact;
+                    const bool crossed{collider.type == collision::StaticShapeType::Segment &&
+                                       sweepSegment(i, previous, collider, contact)};
+                    if (!crossed && !collideStatic(i, collider, contact)) {
+                        return;
+                    }
+
+                    PHYSX_TRACE(tracer.constraintClamp(i, contact.depth));
+                    px[i] -= contact.normalX * contact.depth;
+                    py[i] -= contact.normalY * contact.depth;
+                    stopStoredVelocity(i, {contact.normalX, contact.normalY});
+                });
+            }
+        });
+    }
+
+    /**
+     * @brief Tests a body against one collider.
+     * @param body
+     *          The index of the body.
+     * @param shape
+     *          The collider.
+     * @param contact
+     *          Receives the normal, pointing from the body into the collider, and the depth. The body indices are
+     *          left unset.
+     * @return True if they overlap.
+     */
+    bool Simulation::collideStatic(std::size_t body, const collision::StaticShape& shape,
+                                   collision::Contact& contact) const {
+        const math::f32 x{bodies.getPositionX()[body]};
+        const math::f32 y{bodies.getPositionY()[body]};
+
+        if (bodies.getShape()[body] == dynamic::ShapeType::Circle) {
+            const math::f32 radius{bodies.getRadius()[body]};
+            switch (shape.type) {
+                case collision::StaticShapeType::Segment:
+                    return collision::collideCircleSegment(x, y, radius, shape.x, shape.y, shape.endX, shape.endY,
+                                                           contact);
+                case collision::StaticShapeType::Box:
+                    return collision::collideCircleBox(x, y, radius, shape.x, shape.y, shape.halfWidth,
+                                                       shape.halfHeight, contact);
+                case collision::StaticShapeType::Circle:
+                    return collision::collideCircles(x, y, radius, shape.x, shape.y, shape.radius, contact);
+            }
+            return false;
+        }
+
+        const math::f32 halfWidth{bodies.getWidth()[body] / 2.f};
+        const math::f32 halfHeight{bodies.getHeight()[body] / 2.f};
+        switch (shape.type) {
+            case collision::StaticShapeType::Segment:
+                return collision::collideBoxSegment(x, y, halfWidth, halfHeight, shape.x, shape.y, shape.endX,
+                                                    shape.endY, contact);
+            case collision::StaticShapeType::Box:
+                return collision::collideBoxes(x, y, halfWidth, halfHeight, shape.x, shape.y, shape.halfWidth,
+                                               shape.halfHeight, contact);
+            case collision::StaticShapeType::Circle:
+                if (!collision::collideCircleBox(shape.x, shape.y, shape.radius, x, y, halfWidth, halfHeight,
+                                                 contact)) {
+                    return false;
+                }
+                contact.normalX = -contact.normalX;
+                contact.normalY = -contact.normalY;
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Checks whether the center of a body passed through a segment during the step, which a fast body can
+     * do without ever overlapping it. Only a body that started the step clear of the segment counts, since one that
+     * already overlapped it may have been pushed part of the way through by its neighbours.
+     * @param body
+     *          The index of the body.
+     * @param previous
+     *          The position of the body at the start of the step.
+     * @param segment
+     *          The segment.
+     * @param contact
+     *          Receives the normal of the segment, pointing from the side the body started on, and the depth that
+     *          puts the body back on that side.
+     * @return True if the body crossed the segment.
+     */
+    bool Simulation::sweepSegment(std::size_t body, const math::Vec2f& previous,
+                                  const collision::StaticShape& segment, collision::Contact& contact) const {
+        const math::f32 ex{segment.endX - segment.x};
+        const math::f32 ey{segment.endY - segment.y};
+        const math::f32 lengthSquared{ex * ex + ey * ey};
+        if (lengthSquared == 0.f) {
+            return false;
+        }
+
+        const math::f32 length{std::sqrt(lengthSquared)};
+        const math::f32 normalX{-ey / length};
+        const math::f32 normalY{ex / length};
+        const math::f32 x{bodies.getPositionX()[body]};
+        const math::f32 y{bodies.getPositionY()[body]};
+        const bool circle{bodies.getShape()[body] == dynamic::ShapeType::Circle};
+        const math::f32 extent{circle ? bodies.getRadius()[body]
+                                      : (bodies.getWidth()[body] * std::abs(normalX) +
+                                         bodies.getHeight()[body] * std::abs(normalY)) / 2.f};
+        const math::f32 before{normalX * (previous.getX() - segment.x) + normalY * (previous.getY() - segment.y)};
+        const math::f32 after{normalX * (x - segment.x) + normalY * (y - segment.y)};
+        if (std::abs(before) < extent || (before > 0.f) == (after > 0.f)) {
+            return false;
+        }
+
+        const math::f32 fraction{before / (before - after)};
+        const math::f32 crossX{previous.getX() + (x - previous.getX()) * fraction};
+        const math::f32 crossY{previous.getY() + (y - previous.getY()) * fraction};
+        const math::f32 along{((crossX - segment.x) * ex + (crossY - segment.y) * ey) / lengthSquared};
+        if (along < 0.f || along > 1.f) {
+            return false;
+        }
+
+        const math::f32 side{before > 0.f ? 1.f : -1.f};
+        contact.normalX = -side * normalX;
+        contact.normalY = -side * normalY;
+        contact.depth = extent + std::abs(after);
+        contact.pointCount = 1;
+        contact.pointX[0] = crossX;
+        contact.pointY[0] = crossY;
+        return true;
+    }
+
+    /**
+     * @brief Fits the grid broadphase to the boundary and the colliders, the region bodies are held in.
+     */
+    void Simulation::updateGridBounds() {
+        collision::AABB region{colliders.getBounds()};
+        if (hasBoundary()) {
+            region = region.merged({constraintCenter.getX() - constraintRadius,
+                                    constraintCenter.getY() - constraintRadius,
+                                    constraintCenter.getX() + constraintRadius,
+                                    constraintCenter.getY() + constraintRadius});
+        }
+        if (region.isEmpty()) {
+            region = {0.f, 0.f, 1000.f, 1000.f};
+        }
+        grid.setBounds({region.minX, region.minY}, {region.maxX, region.maxY});
+    }
+
+    /**
+     * @brief Finds the touching pairs with the selected broadphase and the narrowphase.
+     *
+     * Contact generation only reads the bodies and writes to @c contacts, and the solver then consumes the whole
+     * buffer, so every contact of a step is found from the same positions.
+     * @param dt
+     *          The time step.
+     */
     void Simulation::checkCollisions(math::f32 dt) {
-//        float responseCEOF{0.75f};
-//        uint64_t numObjects{objects.size()};
-//
-//        for (uint64_t i{0}; i < numObjects; ++i) {
-//            auto& object1{objects[i]};
-//            auto cast1{dynamic_cast<object::Circle2D*>(object1)};
-//
-//            for (uint64_t k{i + 1}; k < numObjects; ++k) {
-//                auto& object2{objects[k]};
-//                auto cast2{dynamic_cast<object::Circle2D*>(object2)};
-//
-//                math::Vec2f v{object1->getRb()->getPosition() - object2->getRb()->getPosition()};
-//                float distance{utils::length(v)};
-//                float minDistance{cast1->getRadius() + cast2->getRadius()};
-//
-//                if (distance < (minDistance * minDistance)) {
-//                    float distance2{std::sqrt(distance)};
-//                    math::Vec2f n{v / distance2};
-//                    float massRatio1 = cast1->getRadius() / (cast1->getRadius() + cast2->getRadius());
-//                    float massRatio2 = cast2->getRadius() / (cast1->getRadius() + cast2->getRadius());
-//                    float delta = 0.5f * responseCEOF * (distance2 - minDistance);
-//
-//                    auto pos1 = cast1->getRb()->getPosition();
-//                    auto pos2 = cast2->getRb()->getPosition();
-//
-//                    pos1 -= n * (massRatio2 * delta);
-//                    pos2 += n * (massRatio1 * delta);
-//                    cast1->getRb()->setPosition(pos1);
-//                    cast2->getRb()->setPosition(pos2);
-//                }
-//            }
-//        }
-
-        for (std::size_t i{0}; i < objects.size(); ++i) {
-            auto* obj1{dynamic_cast<object::Circle2D*>(objects[i])};
-
-            for (std::size_t k{i + 1}; k < objects.size(); ++k) {
-                auto* obj2{dynamic_cast<object::Circle2D*>(objects[k])};
-
-                if (checkSATCollision(*obj1, *obj2)) {
-                    LLOG_DEBUG("COLLISION")
-                    handleCollisionResponse(*obj1, *obj2);
-//                    obj1->getRb()->setVelocity({10, 0});
-//                    obj2->getRb()->setVelocity({-10, 0});
+        contacts.clear();
+        if (bodies.size() < 2) {
+            return;
+        }
+
+        switch (broadphase) {
+            case collision::BroadphaseType::AABBTree:
+            case collision::BroadphaseType::SweepAndPrune:
+                checkPairCollisions();
+                break;
+            case collision::BroadphaseType::UniformGrid:
+            default:
+                checkGridCollisions();
+                break;
+        }
+
+        PHYSX_PROFILE_COUNT(profiler, utils::ProfileCounter::Contacts, contacts.size());
+    }
+
+    /**
+     * @brief Finds the contacts using the uniform grid.
+     *
+     * The bodies are binned into a uniform grid whose cells are as wide as the largest body, so only bodies in the
+     * same or neighbouring cells are tested against each other. The cells are split into fixed blocks of
+     * @c cellsPerBlock that are searched in parallel, each into its own buffer. The buffers are then joined in
+     * block order, so the contacts do not depend on the thread count. Cells holding only sleeping or static bodies
+     * are skipped.
+     */
+    void Simulation::checkGridCollisions() {
+        {
+            PHYSX_PROFILE_SCOPE(profiler, utils::ProfilePhase::Broadphase);
+            PHYSX_TRACE_SCOPE(tracer, utils::ProfilePhase::Broadphase);
+            const std::size_t count{bodies.size()};
+            const math::f32* radius{bodies.getRadius()};
+            const math::f32* width{bodies.getWidth()};
+            const math::f32* height{bodies.getHeight()};
+
+            ///< Squared bounding radius, the halved diagonal of a rectangle.
+            math::f32 maxRadiusSquared{0.f};
+            for (std::size_t i{0}; i < count; ++i) {
+                maxRadiusSquared = std::max({maxRadiusSquared, radius[i] * radius[i],
+                                             (width[i] * width[i] + height[i] * height[i]) / 4.f});
+            }
+
+            grid.build(bodies.getPositionX(), bodies.getPositionY(), count, 2.f * std::sqrt(maxRadiusSquared),
+                       sleepEnabled ? bodies.getIntegrationGroups() : nullptr);
+        }
+
+        PHYSX_PROFILE_SCOPE(profiler, utils::ProfilePhase::Narrowphase);
+        PHYSX_TRACE_SCOPE(tracer, utils::ProfilePhase::Narrowphase);
+
+        const math::i32 columns{grid.getColumns()};
+        const auto cellCount{static_cast<std::size_t>(columns * grid.getRows())};
+        const std::size_t blockCount{(cellCount + cellsPerBlock - 1) / cellsPerBlock};
+        blockContacts.resize(blockCount);
+
+        threadPool->parallelFor(blockCount, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t block{begin}; block < end; ++block) {
+                std::vector<collision::Contact>& out{blockContacts[block]};
+                out.clear();
+                for (std::size_t k{block * cellsPerBlock}; k < std::min(cellCount, (block + 1) * cellsPerBlock); ++k) {
+                    const auto cell{static_cast<math::i32>(k)};
+                    collideCell(cell % columns, cell / columns, out);
                 }
             }
+        });
+
+        for (const auto& block : blockContacts) {
+            contacts.insert(contacts.end(), block.begin(), block.end());
         }
     }
 
-    bool Simulation::checkSATCollision(object::Circle2D& a, object::Circle2D& b) {
-        // Calculate the vector from circleA center to circleB center.
-        math::f32 dx{b.getRb()->getPosition().getX() - a.getRb()->getPosition().getX()};
-        math::f32 dy{b.getRb()->getPosition().getY() - a.getRb()->getPosition().getY()};
+    /**
+     * @brief Finds the contacts using a broadphase that produces a pair list, the dynamic AABB tree or sweep and
+     * prune.
+     *
+     * Both keep their state between steps, so only bodies that moved enough cost any work to update. The pairs
+     * they report are tested in order on the calling thread.
+     */
+    void Simulation::checkPairCollisions() {
+        {
+            PHYSX_PROFILE_SCOPE(profiler, utils::ProfilePhase::Broadphase);
+            PHYSX_TRACE_SCOPE(tracer, utils::ProfilePhase::Broadphase);
+            updateBounds();
+            pairs.clear();
 
-        // Calculate the distance between the two circle centers.
-        math::f32 distance{std::sqrt(dx * dx + dy * dy)};
+            if (broadphase == collision::BroadphaseType::AABBTree) {
+                tree.update(bounds.data(), bounds.size());
+                tree.findPairs(pairs);
+            } else {
+                sweepAndPrune.update(bounds.data(), bounds.size());
+                sweepAndPrune.findPairs(bounds.data(), pairs);
+            }
+        }
 
-        // If the distance is less than the sum of the radii, they are colliding.
-        return distance < (a.getRadius() + b.getRadius());
+        PHYSX_PROFILE_SCOPE(profiler, utils::ProfilePhase::Narrowphase);
+        PHYSX_TRACE_SCOPE(tracer, utils::ProfilePhase::Narrowphase);
+        for (const auto& pair : pairs) {
+            collidePair(pair.a, pair.b, contacts);
+        }
+    }
+
+    /**
+     * @brief Computes the bounds of every body from its shape. Removed bodies get an empty box.
+     */
+    void Simulation::updateBounds() {
+        const std::size_t count{bodies.size()};
+        const dynamic::ShapeType* shape{bodies.getShape()};
+        const math::f32* px{bodies.getPositionX()};
+        const math::f32* py{bodies.getPositionY()};
+        const math::f32* radius{bodies.getRadius()};
+        const math::f32* width{bodies.getWidth()};
+        const math::f32* height{bodies.getHeight()};
+
+        bounds.resize(count);
+        for (std::size_t i{0}; i < count; ++i) {
+            switch (shape[i]) {
+                case dynamic::ShapeType::Circle:
+                    bounds[i] = {px[i] - radius[i], py[i] - radius[i], px[i] + radius[i], py[i] + radius[i]};
+                    break;
+                case dynamic::ShapeType::Rectangle:
+                    bounds[i] = {px[i] - width[i] / 2.f, py[i] - height[i] / 2.f,
+                                 px[i] + width[i] / 2.f, py[i] + height[i] / 2.f};
+                    break;
+                case dynamic::ShapeType::None:
+                default:
+                    bounds[i] = collision::AABB::empty();
+                    break;
+            }
+        }
+    }
+
+    /**
+     * @brief Tests the candidate pairs owned by one grid cell.
+     * @param column
+     *          The column of the cell.
+     * @param row
+     *          The row of the cell.
+     * @param out
+     *          Receives the contacts found.
+     */
+    void Simulation::collideCell(math::i32 column, math::i32 row, std::vector<collision::Contact>& out) {
+        grid.forEachPair(column, row, [this, &out](std::uint32_t a, std::uint32_t b) {
+            collidePair(a, b, out);
+        });
+    }
+
+    /**
+     * @brief Dispatches a candidate pair on the shape tags of its bodies through @c collisionHandlers.
+     *
+     * Pairs where neither body is awake and integrated cannot change and are skipped.
+     * @param a
+     *          The index of the first body.
+     * @param b
+     *          The index of the second body.
+     * @param out
+     *          Receives the contact, if the bodies touch.
+     */
+    void Simulation::collidePair(std::size_t a, std::size_t b, std::vector<collision::Contact>& out) {
+        const std::uint8_t* groups{bodies.getIntegrationGroups()};
+        if ((groups[a] | groups[b]) == 0) {
+            return;
+        }
+        PHYSX_PROFILE_THREAD_COUNT(profiler, utils::ProfileCounter::PairsTested, 1);
+
+        const dynamic::ShapeType* shape{bodies.getShape()};
+        const CollisionHandler handler{collisionHandlers[static_cast<std::size_t>(shape[a])]
+                                                        [static_cast<std::size_t>(shape[b])]};
+        collision::Contact contact{};
+        if (handler != nullptr && (this->*handler)(a, b, contact)) {
+            contact.a = static_cast<std::uint32_t>(a);
+            contact.b = static_cast<std::uint32_t>(b);
+            out.push_back(contact);
+            PHYSX_TRACE(tracer.collision(a, b));
+        }
     }
 
-    void Simulation::handleCollisionResponse(object::Circle2D& a, object::Circle2D& b) {
-        // Calculate collision normal
-        math::Vec2f collisionNormal{utils::normalize(b.getRb()->getPosition() - a.getRb()->getPosition())};
+    /**
+     * @brief Resolves every contact found this step and every joint.
+     *
+     * With warm starting, each contact first gets back the impulses its pair took last step, and the impulses it
+     * ends with are cached for the next step. Rigid joints likewise start from their impulses of last step, and
+     * springs apply their force once. The joints, contacts and bodies touching the boundary are then iterated
+     * together @c solverIterations times for velocity, and with split impulses the joints and contacts are then
+     * iterated for position.
+     * @param dt
+     *          The time step.
+     */
+    void Simulation::solveConstraints(math::f32 dt) {
+        PHYSX_PROFILE_SCOPE(profiler, utils::ProfilePhase::Solve);
+        PHYSX_TRACE_SCOPE(tracer, utils::ProfilePhase::Solve);
+        if (warmStartEnabled) {
+            contactCache.warmStart(contacts);
+        }
 
-        // Calculate relative velocity
-        math::Vec2f relativeVelocity{b.getRb()->getVelocity() - a.getRb()->getVelocity()};
-        math::f32 relativeSpeed{utils::dot(relativeVelocity, collisionNormal)};
+        for (auto& contact : contacts) {
+            prepareContact(contact, dt);
+        }
+        if (!joints.hasColors()) {
+            joints.buildColors();
+        }
+        prepareJoints(dt);
+        if (solver == collision::SolverType::Jacobi) {
+            buildBodyContacts();
+            contactImpulses.resize(contacts.size());
+        }
 
-        // Check if objects are moving toward each other
-        if (relativeSpeed > 0) {
-            // Calculate impulse
-            math::f32 impulse{-(1 + restitution) * relativeSpeed / (1 / a.getMass() + 1 / b.getMass())};
+        findBoundaryBodies();
 
-            // Calculate friction impulse
-            math::Vec2f frictionImpulse{relativeVelocity - (collisionNormal * relativeSpeed)};
-            frictionImpulse = utils::normalize(frictionImpulse) * impulse * friction;
+        for (std::size_t iteration{0}; iteration < solverIterations; ++iteration) {
+            solveJointVelocities();
+            solveContactVelocities();
+            solveBoundaryVelocities();
+        }
+        if (positionCorrection == collision::PositionCorrection::SplitImpulse) {
+            for (std::size_t iteration{0}; iteration < solverIterations; ++iteration) {
+                correctJointPositions();
+                correctContactPositions();
+            }
+        }
 
-            // Update velocities
-            math::Vec2f tempA{a.getRb()->getVelocity() - impulse - frictionImpulse};
-            tempA /= a.getMass();
-            tempA = tempA * collisionNormal;
-            a.getRb()->setVelocity(tempA / 25.f);
+        if (warmStartEnabled) {
+            contactCache.store(contacts);
+        }
+    }
 
-            math::Vec2f tempB{b.getRb()->getVelocity() + impulse + frictionImpulse};
-            tempB /= b.getMass();
-            tempB = tempB * collisionNormal;
-            b.getRb()->setVelocity(tempB / 25.f);
+    /**
+     * @brief Makes one velocity pass over the contacts with the chosen @c SolverType.
+     *
+     * Gauss-Seidel applies each impulse straight away, in buffer order. Jacobi first works out the impulse of every
+     * contact from the same velocities on the thread pool, then adds up the impulses on each body over its contacts
+     * in buffer order, so the result does not depend on the thread count.
+     */
+    void Simulation::solveContactVelocities() {
+        if (solver != collision::SolverType::Jacobi) {
+            for (auto& contact : contacts) {
+                handleCollisionResponse(contact);
+            }
+            return;
+        }
+
+        threadPool->parallelFor(contacts.size(), [this](std::size_t begin, std::size_t end) {
+            for (std::size_t k{begin}; k < end; ++k) {
+                contactImpulses[k] = computeContactImpulse(contacts[k], getJacobiSplit(contacts[k]));
+            }
+        });
+        applyJacobiPass([this](std::size_t body, const math::Vec2f& change) {
+            applyStepImpulse(body, change);
+        });
+    }
+
+    /**
+     * @brief Makes one split impulse position pass over the contacts with the chosen @c SolverType, see
+     * @c solveContactVelocities.
+     */
+    void Simulation::correctContactPositions() {
+        if (solver != collision::SolverType::Jacobi) {
+            for (const auto& contact : contacts) {
+                const math::Vec2f normal{contact.normalX, contact.normalY};
+                const math::f32 share{computeContactCorrection(contact, 1.f)};
+                moveBody(contact.a, normal * (-share * getInverseMass(contact.a)));
+                moveBody(contact.b, normal * (share * getInverseMass(contact.b)));
+            }
+            return;
+        }
+
+        threadPool->parallelFor(contacts.size(), [this](std::size_t begin, std::size_t end) {
+            for (std::size_t k{begin}; k < end; ++k) {
+                const collision::Contact& contact{contacts[k]};
+                contactImpulses[k] = math::Vec2f{contact.normalX, contact.normalY} *
+                                     computeContactCorrection(contact, getJacobiSplit(contact));
+            }
+        });
+        applyJacobiPass([this](std::size_t body, const math::Vec2f& offset) {
+            moveBody(body, offset);
+        });
+    }
+
+    /**
+     * @brief Collects the bodies touching the boundary, so the solver can hold them on it.
+     *
+     * The clamp in @c applyConstraints only moves bodies, so on its own the boundary gives a pile no support while
+     * it is solved: the bodies at the bottom keep the weight of the pile as speed into the boundary, and the next
+     * clamp throws them back in. A resting pile then jitters forever and never sleeps. Positions are still left to
+     * the clamp, which turns what the bottom bodies were pushed out by into speed back in, like Baumgarte
+     * correction does for contacts, and that is what keeps the pile from sinking into itself.
+     */
+    void Simulation::findBoundaryBodies() {
+        boundaryBodies.clear();
+        if (!hasBoundary()) {
+            return;
+        }
+
+        const std::uint8_t* groups{bodies.getIntegrationGroups()};
+        for (std::size_t i{0}; i < bodies.size(); ++i) {
+            math::Vec2f normal;
+            if (groups[i] != 0 && getBoundaryGap(i, normal) > -penetrationSlop) {
+                boundaryBodies.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+
+    /**
+     * @brief Takes away the speed into the boundary of every body touching it, one velocity pass. The boundary
+     * only ever pushes inwards and every body is handled on its own, so the order does not matter.
+     */
+    void Simulation::solveBoundaryVelocities() {
+        for (const std::uint32_t body : boundaryBodies) {
+            math::Vec2f normal;
+            getBoundaryGap(body, normal);
+            const math::f32 speed{utils::dot(getStepVelocity(body), normal)};
+            if (speed > 0.f) {
+                applyStepImpulse(body, normal * -speed);
+            }
+        }
+    }
+
+    /**
+     * @brief Gets the number of parts a Jacobi contact splits its impulse into: the most contacts either of its
+     * moving bodies has. This keeps the contacts of a body from all pushing it the same way at once.
+     * @param contact
+     *          The contact.
+     * @return The split, at least one.
+     */
+    math::f32 Simulation::getJacobiSplit(const collision::Contact& contact) const {
+        const std::uint32_t* start{bodyContactStart.data()};
+        const std::uint32_t countA{getInverseMass(contact.a) != 0.f ? start[contact.a + 1] - start[contact.a] : 1};
+        const std::uint32_t countB{getInverseMass(contact.b) != 0.f ? start[contact.b + 1] - start[contact.b] : 1};
+        return static_cast<math::f32>(std::max(countA, countB));
+    }
+
+    /**
+     * @brief Adds up @c contactImpulses on each moving body over its contacts in buffer order and hands the total,
+     * scaled by the inverse mass, to @p apply. Bodies are spread over the thread pool.
+     * @tparam Apply
+     *          Callable as @c apply(std::size_t body, const math::Vec2f& total).
+     * @param apply
+     *          Applies the total to the body.
+     */
+    template<typename Apply>
+    void Simulation::applyJacobiPass(Apply&& apply) {
+        const std::uint32_t* start{bodyContactStart.data()};
+        threadPool->parallelFor(bodies.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t body{begin}; body < end; ++body) {
+                const math::f32 inverseMass{getInverseMass(body)};
+                if (inverseMass == 0.f || start[body] == start[body + 1]) {
+                    continue;
+                }
+
+                math::Vec2f total{};
+                for (std::uint32_t k{start[body]}; k < start[body + 1]; ++k) {
+                    const std::uint32_t index{bodyContacts[k]};
+                    if (contacts[index].b == body) {
+                        total += contactImpulses[index];
+                    } else {
+                        total -= contactImpulses[index];
+                    }
+                }
+                apply(body, total * inverseMass);
+            }
+        });
+    }
+
+    /**
+     * @brief Calls @p function for every joint, color by color. The joints of a color share no bodies, so each
+     * color is spread over the thread pool, except the serial one.
+     * @tparam Function
+     *          Callable as @c function(std::size_t joint).
+     * @param function
+     *          Solves one joint.
+     */
+    template<typename Function>
+    void Simulation::forEachJoint(Function&& function) {
+        const std::uint32_t* order{joints.getOrder()};
+        for (std::size_t color{0}; color < joints.getColorCount(); ++color) {
+            const std::size_t first{joints.getColorBegin(color)};
+            const std::size_t last{joints.getColorEnd(color)};
+            if (!joints.isColorParallel(color)) {
+                for (std::size_t k{first}; k < last; ++k) {
+                    function(order[k]);
+                }
+                continue;
+            }
+
+            threadPool->parallelFor(last - first, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t k{first + begin}; k < first + end; ++k) {
+                    function(order[k]);
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Applies the impulse each rigid joint took last step, with warm starting, and the force of each spring.
+     *
+     * Springs are soft, so their force is worked out implicitly once per step and never iterated, which keeps even
+     * stiff springs stable.
+     * @param dt
+     *          The time step.
+     */
+    void Simulation::prepareJoints(math::f32 dt) {
+        const dynamic::ConstraintType* type{joints.getType()};
+        const math::f32* length{joints.getLength()};
+        const math::f32* stiffness{joints.getStiffness()};
+        const math::f32* damping{joints.getDamping()};
+        math::f32* impulse{joints.getImpulse()};
+
+        forEachJoint([&](std::size_t joint) {
+            math::Vec2f axis;
+            math::f32 distance;
+            getJointAxis(joint, axis, distance);
+
+            if (!warmStartEnabled) {
+                impulse[joint] = 0.f;
+            }
+            if (type[joint] == dynamic::ConstraintType::Spring) {
+                const math::f32 inverseMassSum{getJointInverseMassSum(joint)};
+                const math::f32 stretchSpeed{utils::dot(getJointRelativeVelocity(joint), axis)};
+                const math::f32 softness{(stiffness[joint] * dt + damping[joint]) * dt};
+                impulse[joint] = -(stiffness[joint] * dt * dt * (distance - length[joint]) +
+                                   damping[joint] * dt * stretchSpeed) / (1.f + softness * inverseMassSum);
+            }
+            applyJointImpulse(joint, axis * impulse[joint]);
+        });
+    }
+
+    /**
+     * @brief Makes one velocity pass over the rigid joints, stopping each from stretching or, with Baumgarte
+     * correction, asking it to close a share of its error within the step.
+     */
+    void Simulation::solveJointVelocities() {
+        const dynamic::ConstraintType* type{joints.getType()};
+        const math::f32* length{joints.getLength()};
+        math::f32* impulse{joints.getImpulse()};
+
+        forEachJoint([&](std::size_t joint) {
+            const math::f32 inverseMassSum{getJointInverseMassSum(joint)};
+            if (type[joint] == dynamic::ConstraintType::Spring || inverseMassSum == 0.f) {
+                return;
+            }
+
+            math::Vec2f axis;
+            math::f32 distance;
+            getJointAxis(joint, axis, distance);
+            if (isPointPin(joint)) {
+                // Holding a point constrains both axes, and the anchor does not move
+                const std::uint32_t body{joints.getBodyA()[joint]};
+                const math::Vec2f targetVelocity{positionCorrection == collision::PositionCorrection::Baumgarte
+                                                 ? axis * (correctionFactor * distance) : math::Vec2f{}};
+                applyStepImpulse(body, targetVelocity - getStepVelocity(body));
+                return;
+            }
+
+            const math::f32 targetSpeed{positionCorrection == collision::PositionCorrection::Baumgarte
+                                        ? correctionFactor * (length[joint] - distance) : 0.f};
+            const math::f32 change{(targetSpeed - utils::dot(getJointRelativeVelocity(joint), axis)) /
+                                   inverseMassSum};
+            impulse[joint] += change;
+            applyJointImpulse(joint, axis * change);
+        });
+    }
+
+    /**
+     * @brief Makes one split impulse position pass over the rigid joints, moving the bodies of each a share of the
+     * way back to its length.
+     */
+    void Simulation::correctJointPositions() {
+        const dynamic::ConstraintType* type{joints.getType()};
+        const math::f32* length{joints.getLength()};
+        const std::uint32_t* bodyA{joints.getBodyA()};
+        const std::uint32_t* bodyB{joints.getBodyB()};
+
+        forEachJoint([&](std::size_t joint) {
+            const math::f32 inverseMassSum{getJointInverseMassSum(joint)};
+            if (type[joint] == dynamic::ConstraintType::Spring || inverseMassSum == 0.f) {
+                return;
+            }
+
+            math::Vec2f axis;
+            math::f32 distance;
+            getJointAxis(joint, axis, distance);
+            if (isPointPin(joint)) {
+                moveBody(bodyA[joint], axis * (correctionFactor * distance));
+                return;
+            }
+
+            const math::f32 share{correctionFactor * (distance - length[joint]) / inverseMassSum};
+            moveBody(bodyA[joint], axis * (share * getInverseMass(bodyA[joint])));
+            if (bodyB[joint] != dynamic::ConstraintStore::noBody) {
+                moveBody(bodyB[joint], axis * (-share * getInverseMass(bodyB[joint])));
+            }
+        });
+    }
+
+    /**
+     * @brief Gets the direction from the first body of a joint to the second, or to the anchor of a pin, and how
+     * far apart they are.
+     * @param joint
+     *          The index of the joint.
+     * @param axis
+     *          Receives the unit direction, along the x-axis when the two coincide.
+     * @param distance
+     *          Receives the distance.
+     */
+    void Simulation::getJointAxis(std::size_t joint, math::Vec2f& axis, math::f32& distance) const {
+        const std::uint32_t a{joints.getBodyA()[joint]};
+        const std::uint32_t b{joints.getBodyB()[joint]};
+        const math::Vec2f other{b != dynamic::ConstraintStore::noBody
+                                ? bodies.getPosition(b)
+                                : math::Vec2f{joints.getAnchorX()[joint], joints.getAnchorY()[joint]}};
+        const math::Vec2f offset{other - bodies.getPosition(a)};
+        distance = utils::length(offset);
+        axis = distance > 0.f ? offset / distance : math::Vec2f{1.f, 0.f};
+    }
+
+    /**
+     * @brief Checks whether a joint is a pin of zero length, which holds its body on both axes rather than along
+     * one.
+     * @param joint
+     *          The index of the joint.
+     * @return True for a pin of zero length.
+     */
+    bool Simulation::isPointPin(std::size_t joint) const {
+        return joints.getType()[joint] == dynamic::ConstraintType::Pin && joints.getLength()[joint] == 0.f;
+    }
+
+    /**
+     * @brief Gets the velocity of the second body of a joint relative to the first. Pin anchors do not move.
+     * @param joint
+     *          The index of the joint.
+     * @return The relative velocity, in distance per step.
+     */
+    math::Vec2f Simulation::getJointRelativeVelocity(std::size_t joint) const {
+        const std::uint32_t b{joints.getBodyB()[joint]};
+        const math::Vec2f velocityB{b != dynamic::ConstraintStore::noBody ? getStepVelocity(b) : math::Vec2f{}};
+        return velocityB - getStepVelocity(joints.getBodyA()[joint]);
+    }
+
+    /**
+     * @brief Gets the summed inverse mass of the bodies of a joint. Pin anchors count as static.
+     * @param joint
+     *          The index of the joint.
+     * @return The inverse mass sum, zero if neither end can move.
+     */
+    math::f32 Simulation::getJointInverseMassSum(std::size_t joint) const {
+        const std::uint32_t b{joints.getBodyB()[joint]};
+        return getInverseMass(joints.getBodyA()[joint]) +
+               (b != dynamic::ConstraintStore::noBody ? getInverseMass(b) : 0.f);
+    }
+
+    /**
+     * @brief Adds a joint between two bodies, waking both so that a sleeping body feels it.
+     * @param type
+     *          The kind of joint.
+     * @param a
+     *          The index of the first body.
+     * @param b
+     *          The index of the second body.
+     * @param length
+     *          The length, or negative for the current distance between the bodies.
+     * @param stiffness
+     *          The spring force per unit of stretch.
+     * @param damping
+     *          The spring force per unit of stretching speed.
+     * @return The index of the joint.
+     */
+    std::size_t Simulation::addJoint(dynamic::ConstraintType type, std::size_t a, std::size_t b, math::f32 length,
+                                     math::f32 stiffness, math::f32 damping) {
+        bodies.wake(a);
+        bodies.wake(b);
+        if (length < 0.f) {
+            length = utils::distance(bodies.getPosition(a), bodies.getPosition(b));
+        }
+        return joints.add(type, static_cast<std::uint32_t>(a), static_cast<std::uint32_t>(b), length, stiffness,
+                          damping);
+    }
+
+    /**
+     * @brief Applies an impulse to the bodies of a joint.
+     * @param joint
+     *          The index of the joint.
+     * @param impulse
+     *          The impulse on the second body, the first takes the opposite.
+     */
+    void Simulation::applyJointImpulse(std::size_t joint, const math::Vec2f& impulse) {
+        const std::uint32_t a{joints.getBodyA()[joint]};
+        const std::uint32_t b{joints.getBodyB()[joint]};
+        applyStepImpulse(a, impulse * -getInverseMass(a));
+        if (b != dynamic::ConstraintStore::noBody) {
+            applyStepImpulse(b, impulse * getInverseMass(b));
+        }
+    }
+
+    /**
+     * @brief Groups the contact indices by body, each group in buffer order, for the Jacobi passes.
+     */
+    void Simulation::buildBodyContacts() {
+        const std::size_t count{bodies.size()};
+        bodyContactStart.assign(count + 1, 0);
+        for (const auto& contact : contacts) {
+            ++bodyContactStart[contact.a + 1];
+            ++bodyContactStart[contact.b + 1];
+        }
+        for (std::size_t i{0}; i < count; ++i) {
+            bodyContactStart[i + 1] += bodyContactStart[i];
+        }
+
+        bodyContacts.resize(contacts.size() * 2);
+        bodyContactFill.assign(bodyContactStart.begin(), bodyContactStart.end() - 1);
+        for (std::size_t k{0}; k < contacts.size(); ++k) {
+            bodyContacts[bodyContactFill[contacts[k].a]++] = static_cast<std::uint32_t>(k);
+            bodyContacts[bodyContactFill[contacts[k].b]++] = static_cast<std::uint32_t>(k);
+        }
+    }
+
+    /**
+     * @brief Tests two circles.
+     * @param a
+     *          The index of the first circle.
+     * @param b
+     *          The index of the second circle.
+     * @param contact
+     *          Receives the contact.
+     * @return True if they overlap.
+     */
+    bool Simulation::collideCircles(std::size_t a, std::size_t b, collision::Contact& contact) const {
+        const math::f32* px{bodies.getPositionX()};
+        const math::f32* py{bodies.getPositionY()};
+        const math::f32* radius{bodies.getRadius()};
+        return collision::collideCircles(px[a], py[a], radius[a], px[b], py[b], radius[b], contact);
+    }
+
+    /**
+     * @brief Tests a circle against a rectangle.
+     * @param a
+     *          The index of the circle.
+     * @param b
+     *          The index of the rectangle.
+     * @param contact
+     *          Receives the contact.
+     * @return True if they overlap.
+     */
+    bool Simulation::collideCircleRectangle(std::size_t a, std::size_t b, collision::Contact& contact) const {
+        const math::f32* px{bodies.getPositionX()};
+        const math::f32* py{bodies.getPositionY()};
+        return collision::collideCircleBox(px[a], py[a], bodies.getRadius()[a], px[b], py[b],
+                                           bodies.getWidth()[b] / 2.f, bodies.getHeight()[b] / 2.f, contact);
+    }
+
+    /**
+     * @brief Tests a rectangle against a circle.
+     * @param a
+     *          The index of the rectangle.
+     * @param b
+     *          The index of the circle.
+     * @param contact
+     *          Receives the contact.
+     * @return True if they overlap.
+     */
+    bool Simulation::collideRectangleCircle(std::size_t a, std::size_t b, collision::Contact& contact) const {
+        if (!collideCircleRectangle(b, a, contact)) {
+            return false;
+        }
+        contact.normalX = -contact.normalX;
+        contact.normalY = -contact.normalY;
+        return true;
+    }
+
+    /**
+     * @brief Tests two rectangles.
+     * @param a
+     *          The index of the first rectangle.
+     * @param b
+     *          The index of the second rectangle.
+     * @param contact
+     *          Receives the contact.
+     * @return True if they overlap.
+     */
+    bool Simulation::collideRectangles(std::size_t a, std::size_t b, collision::Contact& contact) const {
+        const math::f32* px{bodies.getPositionX()};
+        const math::f32* py{bodies.getPositionY()};
+        const math::f32* width{bodies.getWidth()};
+        const math::f32* height{bodies.getHeight()};
+        return collision::collideBoxes(px[a], py[a], width[a] / 2.f, height[a] / 2.f, px[b], py[b], width[b] / 2.f,
+                                       height[b] / 2.f, contact);
+    }
+
+    /**
+     * @brief Builds the contact islands of this step and puts the ones that have rested long enough to sleep.
+     *
+     * A sleeping body touched by or jointed to an awake one wakes its whole island. Integrated bodies in contact or
+     * jointed together are then joined into islands with a union-find, static bodies do not join islands
+     * together. An island sleeps once every body in it has moved slower than @c sleepSpeed for @c sleepSteps
+     * steps in a row.
+     * @param dt
+     *          The time step.
+     */
+    void Simulation::updateSleep(math::f32 dt) {
+        if (!sleepEnabled) {
+            return;
+        }
+        PHYSX_PROFILE_SCOPE(profiler, utils::ProfilePhase::Sleep);
+        PHYSX_TRACE_SCOPE(tracer, utils::ProfilePhase::Sleep);
+
+        const std::size_t count{bodies.size()};
+        const std::uint8_t* rbEnabled{bodies.getRbEnabled()};
+
+        islandParents.resize(count);
+        for (std::size_t i{0}; i < count; ++i) {
+            islandParents[i] = static_cast<std::uint32_t>(i);
+        }
+
+        for (const auto& contact : contacts) {
+            bodies.wake(contact.a);
+            bodies.wake(contact.b);
+
+            if (rbEnabled[contact.a] != 0 && rbEnabled[contact.b] != 0) {
+                const std::uint32_t rootA{findIsland(contact.a)};
+                const std::uint32_t rootB{findIsland(contact.b)};
+                islandParents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+            }
+        }
+
+        const std::uint32_t* jointA{joints.getBodyA()};
+        const std::uint32_t* jointB{joints.getBodyB()};
+        for (std::size_t joint{0}; joint < joints.size(); ++joint) {
+            const std::uint32_t a{jointA[joint]};
+            const std::uint32_t b{jointB[joint]};
+            if (b == dynamic::ConstraintStore::noBody || rbEnabled[a] == 0 || rbEnabled[b] == 0) {
+                continue;
+            }
+
+            if (!bodies.isAsleep(a) || !bodies.isAsleep(b)) {
+                bodies.wake(a);
+                bodies.wake(b);
+            }
+            const std::uint32_t rootA{findIsland(a)};
+            const std::uint32_t rootB{findIsland(b)};
+            islandParents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+        }
+
+        const std::uint8_t* groups{bodies.getIntegrationGroups()};
+        const math::f32* px{bodies.getPositionX()};
+        const math::f32* py{bodies.getPositionY()};
+        const math::f32* ox{bodies.getPositionOldX()};
+        const math::f32* oy{bodies.getPositionOldY()};
+        std::uint16_t* sleepFrames{bodies.getSleepFrames()};
+        const math::f32 limit{sleepSpeed * dt};
+
+        islandSleepFrames.assign(count, std::numeric_limits<std::uint16_t>::max());
+        for (std::size_t i{0}; i < count; ++i) {
+            if (groups[i] == 0) {
+                continue;
+            }
+
+            const math::f32 dx{px[i] - ox[i]};
+            const math::f32 dy{py[i] - oy[i]};
+            const bool resting{dx * dx + dy * dy < limit * limit};
+            sleepFrames[i] = resting ? static_cast<std::uint16_t>(std::min(sleepFrames[i] + 1, 0xFFFF)) : 0;
+
+            std::uint16_t& islandFrames{islandSleepFrames[findIsland(static_cast<std::uint32_t>(i))]};
+            islandFrames = std::min(islandFrames, sleepFrames[i]);
+        }
+
+        islandHeads.assign(count, std::numeric_limits<std::uint32_t>::max());
+        for (std::size_t i{0}; i < count; ++i) {
+            if (groups[i] == 0) {
+                continue;
+            }
+
+            const std::uint32_t root{findIsland(static_cast<std::uint32_t>(i))};
+            if (islandSleepFrames[root] < sleepSteps) {
+                continue;
+            }
+
+            if (islandHeads[root] == std::numeric_limits<std::uint32_t>::max()) {
+                islandHeads[root] = static_cast<std::uint32_t>(i);
+            }
+            bodies.sleep(i, islandHeads[root]);
+        }
+    }
+
+    /**
+     * @brief Finds the root of a body's island, halving the path on the way.
+     * @param body
+     *          The index of the body.
+     * @return The index of the root body.
+     */
+    std::uint32_t Simulation::findIsland(std::uint32_t body) {
+        while (islandParents[body] != body) {
+            islandParents[body] = islandParents[islandParents[body]];
+            body = islandParents[body];
+        }
+        return body;
+    }
+
+    /**
+     * @brief Sets the speed a contact should separate at, remembers how far apart its bodies start and applies the
+     * impulses it starts with.
+     *
+     * The bounce is taken from the approach speed before any impulse of this step, and only for approach speeds
+     * above @c restitutionSpeed, so resting contacts do not jitter. Only a pair that was not already pushing last
+     * step bounces, since in a pile the solver leaves some approach speed on lasting contacts and bouncing on it
+     * feeds energy in every step. Without warm starting every pair counts as new. With Baumgarte correction the
+     * contact also asks for enough speed to close a share of its overlap within the step, at most
+     * @c maxLinearCorrection.
+     * @param contact
+     *          The contact.
+     * @param dt
+     *          The time step.
+     */
+    void Simulation::prepareContact(collision::Contact& contact, math::f32 dt) {
+        const math::Vec2f normal{contact.normalX, contact.normalY};
+        const math::f32 approachSpeed{-utils::dot(getStepVelocity(contact.b) - getStepVelocity(contact.a), normal)};
+        const bool bounces{approachSpeed > restitutionSpeed * dt && contact.normalImpulse == 0.f};
+        contact.targetSpeed = bounces ? restitution * approachSpeed : 0.f;
+        if (positionCorrection == collision::PositionCorrection::Baumgarte) {
+            contact.targetSpeed = std::max(contact.targetSpeed, correctionFactor *
+                                           std::clamp(contact.depth - penetrationSlop, 0.f, maxLinearCorrection));
+        }
+        contact.depthBase = contact.depth + utils::dot(bodies.getPosition(contact.b) - bodies.getPosition(contact.a),
+                                                       normal);
+
+        if (contact.normalImpulse != 0.f || contact.tangentImpulse != 0.f) {
+            const math::Vec2f tangent{-contact.normalY, contact.normalX};
+            applyContactImpulse(contact, normal * contact.normalImpulse + tangent * contact.tangentImpulse);
+        }
+    }
+
+    /**
+     * @brief Resolves one contact with an impulse along its normal and friction, one Gauss-Seidel step.
+     * @param contact
+     *          The contact.
+     */
+    void Simulation::handleCollisionResponse(collision::Contact& contact) {
+        applyContactImpulse(contact, computeContactImpulse(contact, 1.f));
+    }
+
+    /**
+     * @brief Works out the impulse that brings a contact to its target speed along the normal and stops its
+     * sliding, and adds it to the totals on the contact.
+     *
+     * The total normal impulse never pulls the bodies together, and the total friction impulse is bounded by the
+     * normal one. Static bodies take no impulse, so the other body takes all of it.
+     * @param contact
+     *          The contact.
+     * @param split
+     *          The number of parts the impulse is split into, of which only one is returned.
+     * @return The impulse on the second body, the first takes the opposite.
+     */
+    math::Vec2f Simulation::computeContactImpulse(collision::Contact& contact, math::f32 split) const {
+        const math::f32 inverseMassSum{getInverseMass(contact.a) + getInverseMass(contact.b)};
+        if (inverseMassSum == 0.f) {
+            return {};
+        }
+
+        const math::Vec2f normal{contact.normalX, contact.normalY};
+        const math::Vec2f tangent{-contact.normalY, contact.normalX};
+        const math::Vec2f relativeVelocity{getStepVelocity(contact.b) - getStepVelocity(contact.a)};
+        const math::f32 effectiveMass{1.f / (inverseMassSum * split)};
+
+        // The normal impulse leaves the sliding speed alone, so both come from the same velocity
+        const math::f32 normalTotal{std::max(contact.normalImpulse + effectiveMass *
+                                             (contact.targetSpeed - utils::dot(relativeVelocity, normal)), 0.f)};
+        const math::f32 maxFriction{friction * normalTotal};
+        const math::f32 tangentTotal{std::clamp(contact.tangentImpulse -
+                                                effectiveMass * utils::dot(relativeVelocity, tangent),
+                                                -maxFriction, maxFriction)};
+
+        const math::Vec2f impulse{normal * (normalTotal - contact.normalImpulse) +
+                                  tangent * (tangentTotal - contact.tangentImpulse)};
+        contact.normalImpulse = normalTotal;
+        contact.tangentImpulse = tangentTotal;
+        return impulse;
+    }
+
+    /**
+     * @brief Works out how far to push the bodies of a contact apart, for split impulses.
+     *
+     * The overlap is measured from where the bodies are now, so corrections made earlier in the step count. The
+     * contact is not found again between passes, so its normal is only trusted for small moves: a pass removes at
+     * most @c maxLinearCorrection and all passes of a step together at most @c maxStepCorrection. Without the caps,
+     * a deep pile under many iterations pushes bodies past each other's centers, where the stale normal points the
+     * wrong way.
+     * @param contact
+     *          The contact.
+     * @param split
+     *          The number of parts the correction is split into, of which only one is returned.
+     * @return The correction times the combined mass. Each body moves it times its inverse mass.
+     */
+    math::f32 Simulation::computeContactCorrection(const collision::Contact& contact, math::f32 split) const {
+        const math::f32 inverseMassSum{getInverseMass(contact.a) + getInverseMass(contact.b)};
+        if (inverseMassSum == 0.f) {
+            return 0.f;
+        }
+
+        const math::Vec2f normal{contact.normalX, contact.normalY};
+        const math::f32 depth{contact.depthBase -
+                              utils::dot(bodies.getPosition(contact.b) - bodies.getPosition(contact.a), normal)};
+        const math::f32 separated{contact.depth - depth};
+        const math::f32 correction{std::min({depth - penetrationSlop, maxLinearCorrection,
+                                             maxStepCorrection - separated})};
+        return correctionFactor * std::max(correction, 0.f) / (inverseMassSum * split);
+    }
+
+    /**
+     * @brief Applies an impulse to the bodies of a contact.
+     * @param contact
+     *          The contact.
+     * @param impulse
+     *          The impulse on the second body, the first takes the opposite.
+     */
+    void Simulation::applyContactImpulse(const collision::Contact& contact, const math::Vec2f& impulse) {
+        applyStepImpulse(contact.a, impulse * -getInverseMass(contact.a));
+        applyStepImpulse(contact.b, impulse * getInverseMass(contact.b));
+    }
+
+    /**
+     * @brief Gets the inverse mass of a body, zero for bodies without a rigid body so that they never move.
+     * @param index
+     *          The index of the body.
+     * @return The inverse mass.
+     */
+    math::f32 Simulation::getInverseMass(std::size_t index) const {
+        return bodies.getRbEnabled()[index] != 0 ? 1.f / bodies.getMass()[index] : 0.f;
+    }
+
+    /**
+     * @brief Gets the distance a body moved over the last step, which is the velocity every integrator keeps. For
+     * Verlet bodies it is the difference of their positions.
+     * @param index
+     *          The index of the body.
+     * @return The velocity, in distance per step.
+     */
+    math::Vec2f Simulation::getStepVelocity(std::size_t index) const {
+        if (bodies.getIntegration()[index] == dynamic::IntegrationType::Verlet) {
+            return {bodies.getPositionX()[index] - bodies.getPositionOldX()[index],
+                    bodies.getPositionY()[index] - bodies.getPositionOldY()[index]};
+        }
+        return bodies.getVelocity(index);
+    }
+
+    /**
+     * @brief Changes the velocity of a body, see @c getStepVelocity. Does nothing for a zero change, so static
+     * bodies can be passed one.
+     * @param index
+     *          The index of the body.
+     * @param change
+     *          The change in distance per step.
+     */
+    void Simulation::applyStepImpulse(std::size_t index, const math::Vec2f& change) {
+        if (change.getX() == 0.f && change.getY() == 0.f) {
+            return;
+        }
+
+        if (bodies.getIntegration()[index] == dynamic::IntegrationType::Verlet) {
+            bodies.getPositionOldX()[index] -= change.getX();
+            bodies.getPositionOldY()[index] -= change.getY();
+        } else {
+            bodies.setVelocity(index, bodies.getVelocity(index) + change);
+        }
+    }
+
+    /**
+     * @brief Moves a body without changing its velocity, see @c getStepVelocity.
+     * @param index
+     *          The index of the body.
+     * @param offset
+     *          The distance to move it by.
+     */
+    void Simulation::moveBody(std::size_t index, const math::Vec2f& offset) {
+        if (offset.getX() == 0.f && offset.getY() == 0.f) {
+            return;
+        }
+
+        bodies.getPositionX()[index] += offset.getX();
+        bodies.getPositionY()[index] += offset.getY();
+        if (bodies.getIntegration()[index] == dynamic::IntegrationType::Verlet) {
+            bodies.getPositionOldX()[index] += offset.getX();
+            bodies.getPositionOldY()[index] += offset.getY();
+        }
+    }
+
+    /**
+     * @brief Takes away the part of the velocity of a body that points along a normal, for a body that was just moved
+     * out of something by its position alone. Verlet bodies are left alone, since their velocity already followed.
+     * @param index
+     *          The index of the body.
+     * @param normal
+     *          The unit normal pointing from the body into what it was moved out of.
+     */
+    void Simulation::stopStoredVelocity(std::size_t index, const math::Vec2f& normal) {
+        if (bodies.getIntegration()[index] == dynamic::IntegrationType::Verlet) {
+            return;
+        }
 
-            // Perform position correction to resolve overlap
-            math::f32 overlap{a.getRadius() + b.getRadius() - utils::distance(a.getRb()->getPosition(), b.getRb()->getPosition())};
-            math::Vec2f correction{collisionNormal * 0.5f * overlap};
-            a.getRb()->setPosition(a.getRb()->getPosition() - correction);
-            b.getRb()->setPosition(b.getRb()->getPosition() + correction);
+        const math::Vec2f velocity{bodies.getVelocity(index)};
+        const math::f32 speed{velocity.getX() * normal.getX() + velocity.getY() * normal.getY()};
+        if (speed > 0.f) {
+            bodies.setVelocity(index, velocity - normal * speed);
         }
     }
-} // namespace physx::core
\ No newline at end of file
+} // namespace physx::core
@@ -11,22 +11,22 @@ namespace physx::core::object {
 
     /**
      * @brief @c Circle2D constructor.
-     * @param radius
-     *          The radius of the circle.
-     * @param position
-     *          The position of the circle.
-     * @param rb
-     *          Whether the circle has a @c RigidBody2D or not.
+     * @param store
+     *          The @c BodyStore holding the circle.
+     * @param index
+     *          The index of the circle in the store.
      */
-    Circle2D::Circle2D(math::f32 radius, const math::Vec2f& position, bool rb)
-        : Object2D{position, rb},
-          radius{radius} {
+    Circle2D::Circle2D(dynamic::BodyStore* store, std::size_t index)
+        : Object2D{store, index} {
     }
 
-    void Circle2D::update(math::f32 dt) {
-        if (rb != nullptr) {
-            rb->updatePosition(dt);
-        }
+    /**
+     * @brief @c Circle2D constructor.
+     * @param object
+     *          A handle to a body with a @c ShapeType::Circle shape.
+     */
+    Circle2D::Circle2D(const Object2D& object)
+        : Object2D{object} {
     }
 
     /**
@@ -34,14 +34,6 @@ namespace physx::core::object {
      * @return The radius.
      */
     math::f32 Circle2D::getRadius() const {
-        return radius;
-    }
-
-    /**
-     * @brief Gets the mass of the @c Circle2D.
-     * @return The masss.
-     */
-    math::f32 Circle2D::getMass() const {
-        return mass;
+        return store->getRadius()[index];
     }
-} // namespace physx::core::object
\ No newline at end of file
+} // namespace physx::core::object
@@ -10,48 +10,81 @@
 namespace physx::core::object {
     /**
      * @brief @c Object2D constructor.
-     * @param position
-     *          The position of the circle.
-     * @param rb
-     *          Whether the circle has a @c RigidBody2D or not.
+     * @param store
+     *          The @c BodyStore holding the body.
+     * @param index
+     *          The index of the body in the store.
      */
-    Object2D::Object2D(const math::Vec2f& position, bool rb)
-        : position{position} {
-        if (rb) {
-            addRigidBody();
-        }
+    Object2D::Object2D(dynamic::BodyStore* store, std::size_t index)
+        : store{store},
+          index{index} {
     }
 
     /**
-     * @brief @c Object2D destructor.
+     * @brief Gets the shape of the @c Object2D.
+     * @return The shape.
      */
-    Object2D::~Object2D() {
-        if (rb != nullptr) {
-            delete rb;
-        }
+    dynamic::ShapeType Object2D::getShape() const {
+        return store->getShape()[index];
     }
 
     /**
-     * @brief Adds a @c RigidBody2D to the @c Object2D.
+     * @brief Gets the index of the @c Object2D in its @c BodyStore.
+     * @return The index.
      */
-    void Object2D::addRigidBody() {
-        rb = new dynamic::RigidBody2D{position};
-        rbEnabled = true;
+    std::size_t Object2D::getIndex() const {
+        return index;
     }
 
     /**
-     * @brief Gets the @c RigidBody2D.
-     * @return The @c RigidBody2D.
+     * @brief Checks if the @c RigidBody is enabled.
+     * @return @c true if the @c RigidBody is enabled, @c false otherwise.
      */
-    dynamic::RigidBody2D* Object2D::getRb() {
-        return rb;
+    bool Object2D::isRbEnabled() const {
+        return store->getRbEnabled()[index] != 0;
     }
 
     /**
-     * @brief Checks if the @c RigidBody is enabled.
-     * @return @c true if the @c RigidBody is enabled, @c false otherwise.
+     * @brief Gets the position of the @c Object2D.
+     * @return The position.
      */
-    bool Object2D::isRbEnabled() const {
-        return rbEnabled;
+    math::Vec2f Object2D::getPosition() const {
+        return store->getPosition(index);
+    }
+
+    /**
+     * @brief Gets the velocity of the @c Object2D.
+     * @return The velocity.
+     */
+    math::Vec2f Object2D::getVelocity() const {
+        return store->getVelocity(index);
+    }
+
+    /**
+     * @brief Gets the mass of the @c Object2D.
+     * @return The mass.
+     */
+    math::f32 Object2D::getMass() const {
+        return store->getMass()[index];
+    }
+
+    /**
+     * @brief Sets the position of the @c Object2D, waking it and its island if it is asleep.
+     * @param newPos
+     *          The new position.
+     */
+    void Object2D::setPosition(const math::Vec2f& newPos) {
+        store->wake(index);
+        store->setPosition(index, newPos);
+    }
+
+    /**
+     * @brief Sets the velocity of the @c Object2D, waking it and its island if it is asleep.
+     * @param newVel
+     *          The new velocity.
+     */
+    void Object2D::setVelocity(const math::Vec2f& newVel) {
+        store->wake(index);
+        store->setVelocity(index, newVel);
     }
-} // namespace physx::core::object
\ No newline at end of file
+} // namespace physx::core::object
@@ -10,25 +10,22 @@
 namespace physx::core::object {
     /**
      * @brief @c Rectangle2D constructor.
-     * @param width
-     *          The width of the rectangle.
-     * @param height
-     *          The height of the rectangle.
-     * @param position
-     *          The position of the rectangle.
-     * @param rb
-     *          Whether the rectangle has a @c RigidBody2D or not.
+     * @param store
+     *          The @c BodyStore holding the rectangle.
+     * @param index
+     *          The index of the rectangle in the store.
      */
-    Rectangle2D::Rectangle2D(float width, float height, const math::Vec2f& position, bool rb)
-        : Object2D{position, rb},
-          width{width},
-          height{height} {
+    Rectangle2D::Rectangle2D(dynamic::BodyStore* store, std::size_t index)
+        : Object2D{store, index} {
     }
 
-    void Rectangle2D::update(float dt) {
-        if (rb != nullptr) {
-            rb->updatePosition(dt);
-        }
+    /**
+     * @brief @c Rectangle2D constructor.
+     * @param object
+     *          A handle to a body with a @c ShapeType::Rectangle shape.
+     */
+    Rectangle2D::Rectangle2D(const Object2D& object)
+        : Object2D{object} {
     }
 
     /**
@@ -36,7 +33,7 @@ namespace physx::core::object {
      * @return The width.
      */
     float Rectangle2D::getWidth() const {
-        return width;
+        return store->getWidth()[index];
     }
 
     /**
@@ -44,6 +41,6 @@ namespace physx::core::object {
      * @return The height.
      */
     float Rectangle2D::getHeight() const {
-        return height;
+        return store->getHeight()[index];
     }
-} // namespace physx::core::object
\ No newline at end of file
+} // namespace physx::core::object
@@ -0,0 +1,555 @@
+/**
+ * @file BodyStore.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/dynamic/BodyStore.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace physx::dynamic {
+    namespace {
+        constexpr std::size_t minCapacity{256};     ///< The capacity of the first allocation
+
+        constexpr char snapshotMagic[8]{'P', 'H', 'Y', 'S', 'X', 'S', 'N', 'P'};
+        constexpr std::uint32_t snapshotVersion{2};
+        constexpr std::uint32_t snapshotByteOrder{0x01020304};  ///< Reads back differently on the other endianness
+        constexpr std::size_t snapshotArrayCount{16};
+        constexpr std::size_t shapeArray{13};           ///< Position of @c shape in the snapshot arrays
+        constexpr std::size_t rbEnabledArray{14};       ///< Position of @c rbEnabled in the snapshot arrays
+        constexpr std::size_t integrationArray{15};     ///< Position of @c integration in the snapshot arrays
+
+        /**
+         * @brief The start of a snapshot file.
+         *
+         * Each saved array follows at its offset, aligned to a cache line, in the order of
+         * @c BodyStore::forEachSnapshotArray. Bumping @c snapshotVersion is required whenever that order, the
+         * element types, what an array holds or this header change. Version 2 holds velocities in distance per step
+         * and the extent of a rectangle as half its shorter side.
+         */
+        struct SnapshotHeader {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t byteOrder;
+            std::uint64_t count;
+            std::uint64_t offsets[snapshotArrayCount];
+            std::uint32_t elementSizes[snapshotArrayCount];
+        };
+
+        constexpr std::uint64_t alignToCacheLine(std::uint64_t offset) {
+            return (offset + utils::Arena::cacheLineSize - 1) & ~std::uint64_t{utils::Arena::cacheLineSize - 1};
+        }
+    } // namespace
+
+    /**
+     * @brief Adds a body to the store, reusing the most recently removed slot if there is one.
+     * @param theShape
+     *          The shape of the body.
+     * @param position
+     *          The position of the body.
+     * @param theRadius
+     *          The radius of a circle body.
+     * @param theWidth
+     *          The width of a rectangle body.
+     * @param theHeight
+     *          The height of a rectangle body.
+     * @param theMass
+     *          The mass of the body.
+     * @param theRbEnabled
+     *          Whether the body is integrated or stays where it is placed.
+     * @param theIntegration
+     *          The numerical integration the body uses.
+     * @return The index of the new body.
+     */
+    std::size_t BodyStore::add(ShapeType theShape, const math::Vec2f& position, math::f32 theRadius,
+                               math::f32 theWidth, math::f32 theHeight, math::f32 theMass, bool theRbEnabled,
+                               IntegrationType theIntegration) {
+        std::size_t index;
+        if (!freeSlots.empty()) {
+            index = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            if (count == capacity) {
+                grow(std::max<std::size_t>(capacity * 2, minCapacity));
+            }
+            index = count++;
+        }
+
+        positionX[index] = position.getX();
+        positionY[index] = position.getY();
+        positionOldX[index] = position.getX();
+        positionOldY[index] = position.getY();
+        velocityX[index] = 0.f;
+        velocityY[index] = 0.f;
+        accelerationX[index] = 0.f;
+        accelerationY[index] = 0.f;
+        radius[index] = theRadius;
+        width[index] = theWidth;
+        height[index] = theHeight;
+        extent[index] = theShape == ShapeType::Circle ? theRadius : std::min(theWidth, theHeight) / 2.f;
+        mass[index] = theMass;
+        shape[index] = theShape;
+        rbEnabled[index] = theRbEnabled ? 1 : 0;
+        integrationGroups[index] = theRbEnabled ? integrationGroup(theIntegration) : 0;
+        integration[index] = theIntegration;
+        asleep[index] = 0;
+        sleepFrames[index] = 0;
+        sleepNext[index] = static_cast<std::uint32_t>(index);
+        integrationCounts[static_cast<std::size_t>(theIntegration)] += theRbEnabled ? 1 : 0;
+        ++shapeCounts[static_cast<std::size_t>(theShape)];
+
+        return index;
+    }
+
+    /**
+     * @brief Removes a body from the store.
+     *
+     * The slot keeps its index with a @c ShapeType::None shape, so it takes no part in the simulation, until @c add
+     * reuses it. Handles to the removed body must not be used afterwards.
+     * @param index
+     *          The index of the body.
+     */
+    void BodyStore::remove(std::size_t index) {
+        if (shape[index] == ShapeType::None) {
+            return;
+        }
+
+        // Bodies resting on this one have lost their support.
+        wake(index);
+        integrationCounts[static_cast<std::size_t>(integration[index])] -= rbEnabled[index];
+        --shapeCounts[static_cast<std::size_t>(shape[index])];
+
+        positionOldX[index] = positionX[index];
+        positionOldY[index] = positionY[index];
+        velocityX[index] = 0.f;
+        velocityY[index] = 0.f;
+        accelerationX[index] = 0.f;
+        accelerationY[index] = 0.f;
+        radius[index] = 0.f;
+        width[index] = 0.f;
+        height[index] = 0.f;
+        extent[index] = 0.f;
+        mass[index] = 0.f;
+        shape[index] = ShapeType::None;
+        rbEnabled[index] = 0;
+        integrationGroups[index] = 0;
+
+        freeSlots.push_back(index);
+    }
+
+    /**
+     * @brief Reserves space for a number of bodies so spawning up to it does not allocate.
+     * @param newCapacity
+     *          The number of bodies to reserve space for.
+     */
+    void BodyStore::reserve(std::size_t newCapacity) {
+        if (newCapacity > capacity) {
+            grow(newCapacity);
+        }
+    }
+
+    /**
+     * @brief Removes every body from the store.
+     *
+     * The arena keeps its slabs, so filling the store again reuses the same memory.
+     */
+    void BodyStore::clear() {
+        arena.reset();
+        count = 0;
+        capacity = 0;
+        freeSlots.clear();
+        std::fill(std::begin(integrationCounts), std::end(integrationCounts), 0);
+        std::fill(std::begin(shapeCounts), std::end(shapeCounts), 0);
+        sleepingCount = 0;
+        snapshot.close();
+    }
+
+    /**
+     * @brief Gets the number of slots in the store, including removed bodies waiting to be reused.
+     * @return The number of slots.
+     */
+    std::size_t BodyStore::size() const {
+        return count;
+    }
+
+    /**
+     * @brief Gets the number of bodies the store can hold before it allocates.
+     * @return The capacity.
+     */
+    std::size_t BodyStore::getCapacity() const {
+        return capacity;
+    }
+
+    /**
+     * @brief Gets the number of removed slots waiting to be reused.
+     * @return The number of free slots.
+     */
+    std::size_t BodyStore::getFreeCount() const {
+        return freeSlots.size();
+    }
+
+    /**
+     * @brief Gets the number of integrated bodies that use an integration type.
+     * @param type
+     *          The integration type.
+     * @return The number of bodies.
+     */
+    std::size_t BodyStore::getIntegrationCount(IntegrationType type) const {
+        return integrationCounts[static_cast<std::size_t>(type)];
+    }
+
+    /**
+     * @brief Gets the number of bodies of a shape.
+     * @param type
+     *          The shape.
+     * @return The number of bodies, not counting removed ones.
+     */
+    std::size_t BodyStore::getShapeCount(ShapeType type) const {
+        return type == ShapeType::None ? 0 : shapeCounts[static_cast<std::size_t>(type)];
+    }
+
+    /**
+     * @brief Calls a function with every array saved in a snapshot, in file order.
+     * @tparam Store
+     *          @c BodyStore or @c const @c BodyStore.
+     * @tparam Function
+     *          Callable with a reference to each array pointer.
+     * @param store
+     *          The store whose arrays to visit.
+     * @param function
+     *          The function to call.
+     */
+    template<typename Store, typename Function>
+    void BodyStore::forEachSnapshotArray(Store& store, Function&& function) {
+        function(store.positionX);
+        function(store.positionY);
+        function(store.positionOldX);
+        function(store.positionOldY);
+        function(store.velocityX);
+        function(store.velocityY);
+        function(store.accelerationX);
+        function(store.accelerationY);
+        function(store.radius);
+        function(store.width);
+        function(store.height);
+        function(store.extent);
+        function(store.mass);
+        function(store.shape);
+        function(store.rbEnabled);
+        function(store.integration);
+    }
+
+    /**
+     * @brief Writes the state of every body to a versioned binary snapshot.
+     *
+     * The arrays are written as they are in memory, including removed slots, so @c loadSnapshot can use them
+     * without converting anything. Snapshots are only portable between machines with the same byte order.
+     * @param path
+     *          The path of the snapshot file.
+     * @throws except::SnapshotException
+     *          If the file cannot be written.
+     */
+    void BodyStore::saveSnapshot(const std::string& path) const {
+        std::ofstream file{path, std::ios::binary | std::ios::trunc};
+        if (!file) {
+            throw except::SnapshotException("Cannot create snapshot file " + path + ".");
+        }
+
+        SnapshotHeader header{};
+        std::copy(std::begin(snapshotMagic), std::end(snapshotMagic), header.magic);
+        header.version = snapshotVersion;
+        header.byteOrder = snapshotByteOrder;
+        header.count = count;
+
+        std::uint64_t offset{alignToCacheLine(sizeof(SnapshotHeader))};
+        std::size_t array{0};
+        forEachSnapshotArray(*this, [&](const auto* data) {
+            header.elementSizes[array] = sizeof(*data);
+            header.offsets[array++] = offset;
+            offset = alignToCacheLine(offset + sizeof(*data) * count);
+        });
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        std::uint64_t written{sizeof(header)};
+        array = 0;
+        forEachSnapshotArray(*this, [&](const auto* data) {
+            static constexpr char padding[utils::Arena::cacheLineSize]{};
+            const std::uint64_t offset{header.offsets[array++]};
+            file.write(padding, static_cast<std::streamsize>(offset - written));
+            file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(sizeof(*data) * count));
+            written = offset + sizeof(*data) * count;
+        });
+
+        if (!file) {
+            throw except::SnapshotException("Cannot write snapshot file " + path + ".");
+        }
+    }
+
+    /**
+     * @brief Replaces every body with the bodies of a snapshot written by @c saveSnapshot.
+     *
+     * The file is memory-mapped and the store points its arrays straight into the mapping, so loading does no
+     * per-body construction and only touches the pages it validates. The arrays move into the arena the first time
+     * the store grows. Every loaded body is awake.
+     * @param path
+     *          The path of the snapshot file.
+     * @throws except::SnapshotException
+     *          If the file cannot be read, is not a snapshot, or was saved by an incompatible version. The store is
+     *          left unchanged.
+     */
+    void BodyStore::loadSnapshot(const std::string& path) {
+        utils::MappedFile file;
+        if (!file.open(path)) {
+            throw except::SnapshotException("Cannot open snapshot file " + path + ".");
+        }
+
+        SnapshotHeader header{};
+        if (file.getSize() < sizeof(header)) {
+            throw except::SnapshotException(path + " is not a snapshot.");
+        }
+        std::memcpy(&header, file.getData(), sizeof(header));
+
+        if (!std::equal(std::begin(snapshotMagic), std::end(snapshotMagic), header.magic)) {
+            throw except::SnapshotException(path + " is not a snapshot.");
+        }
+        if (header.byteOrder != snapshotByteOrder) {
+            throw except::SnapshotException("Snapshot " + path + " was saved with a different byte order.");
+        }
+        if (header.version != snapshotVersion) {
+            throw except::SnapshotException("Snapshot " + path + " has unsupported version " +
+                                            std::to_string(header.version) + ".");
+        }
+
+        bool valid{true};
+        std::size_t array{0};
+        forEachSnapshotArray(*this, [&](const auto* data) {
+            const std::uint64_t offset{header.offsets[array]};
+            const std::uint64_t elementSize{sizeof(*data)};
+            valid = valid && header.elementSizes[array] == elementSize &&
+                    offset % utils::Arena::cacheLineSize == 0 && offset <= file.getSize() &&
+                    header.count <= (file.getSize() - offset) / elementSize;
+            ++array;
+        });
+        if (!valid) {
+            throw except::SnapshotException("Snapshot " + path + " is truncated or corrupt.");
+        }
+
+        const std::size_t loadedCount{static_cast<std::size_t>(header.count)};
+        const std::byte* base{file.getData()};
+        const auto* loadedShape{reinterpret_cast<const ShapeType*>(base + header.offsets[shapeArray])};
+        const auto* loadedRbEnabled{reinterpret_cast<const std::uint8_t*>(base + header.offsets[rbEnabledArray])};
+        const auto* loadedIntegration{
+                reinterpret_cast<const IntegrationType*>(base + header.offsets[integrationArray])};
+        for (std::size_t i{0}; i < loadedCount; ++i) {
+            if (static_cast<std::size_t>(loadedShape[i]) >= shapeTypeCount || loadedRbEnabled[i] > 1 ||
+                static_cast<std::size_t>(loadedIntegration[i]) >= integrationTypeCount) {
+                throw except::SnapshotException("Snapshot " + path + " has an invalid body " + std::to_string(i) +
+                                                ".");
+            }
+        }
+
+        clear();
+        array = 0;
+        forEachSnapshotArray(*this, [&](auto*& data) {
+            using Pointer = std::remove_reference_t<decltype(data)>;
+            data = reinterpret_cast<Pointer>(file.getData() + header.offsets[array++]);
+        });
+        count = loadedCount;
+        capacity = loadedCount;
+
+        integrationGroups = arena.allocateArray<std::uint8_t>(count);
+        asleep = arena.allocateArray<std::uint8_t>(count);
+        sleepFrames = arena.allocateArray<std::uint16_t>(count);
+        sleepNext = arena.allocateArray<std::uint32_t>(count);
+
+        for (std::size_t i{0}; i < count; ++i) {
+            integrationGroups[i] = rbEnabled[i] != 0 ? integrationGroup(integration[i]) : 0;
+            asleep[i] = 0;
+            sleepFrames[i] = 0;
+            sleepNext[i] = static_cast<std::uint32_t>(i);
+            integrationCounts[static_cast<std::size_t>(integration[i])] += rbEnabled[i];
+            if (shape[i] == ShapeType::None) {
+                freeSlots.push_back(i);
+                continue;
+            }
+
+            ++shapeCounts[static_cast<std::size_t>(shape[i])];
+        }
+
+        snapshot = std::move(file);
+    }
+
+    /**
+     * @brief Puts an integrated body to sleep as part of an island.
+     *
+     * The body stops moving and leaves its integration group until it is woken. Sleeping bodies of one island are
+     * linked in a ring, so waking any of them wakes the others.
+     * @param index
+     *          The index of the body.
+     * @param islandHead
+     *          A body of the island already asleep, or @p index itself for the first body of the island.
+     */
+    void BodyStore::sleep(std::size_t index, std::size_t islandHead) {
+        if (asleep[index] != 0 || rbEnabled[index] == 0) {
+            return;
+        }
+
+        positionOldX[index] = positionX[index];
+        positionOldY[index] = positionY[index];
+        velocityX[index] = 0.f;
+        velocityY[index] = 0.f;
+        accelerationX[index] = 0.f;
+        accelerationY[index] = 0.f;
+        integrationGroups[index] = 0;
+        asleep[index] = 1;
+        ++sleepingCount;
+
+        if (islandHead != index) {
+            sleepNext[index] = sleepNext[islandHead];
+            sleepNext[islandHead] = static_cast<std::uint32_t>(index);
+        } else {
+            sleepNext[index] = static_cast<std::uint32_t>(index);
+        }
+    }
+
+    /**
+     * @brief Wakes a sleeping body along with the rest of its island. Does nothing if the body is awake.
+     * @param index
+     *          The index of the body.
+     */
+    void BodyStore::wake(std::size_t index) {
+        if (asleep[index] == 0) {
+            return;
+        }
+
+        std::size_t body{index};
+        do {
+            const std::size_t next{sleepNext[body]};
+            integrationGroups[body] = integrationGroup(integration[body]);
+            asleep[body] = 0;
+            sleepFrames[body] = 0;
+            sleepNext[body] = static_cast<std::uint32_t>(body);
+            --sleepingCount;
+            body = next;
+        } while (body != index);
+    }
+
+    /**
+     * @brief Gets whether a body is asleep.
+     * @param index
+     *          The index of the body.
+     * @return @c true if the body is asleep.
+     */
+    bool BodyStore::isAsleep(std::size_t index) const {
+        return asleep[index] != 0;
+    }
+
+    /**
+     * @brief Gets the number of sleeping bodies.
+     * @return The number of sleeping bodies.
+     */
+    std::size_t BodyStore::getSleepingCount() const {
+        return sleepingCount;
+    }
+
+    /**
+     * @brief Gets the position of a body.
+     * @param index
+     *          The index of the body.
+     * @return The position.
+     */
+    math::Vec2f BodyStore::getPosition(std::size_t index) const {
+        return {positionX[index], positionY[index]};
+    }
+
+    /**
+     * @brief Gets the velocity of a body, as computed by its last integration step.
+     * @param index
+     *          The index of the body.
+     * @return The velocity.
+     */
+    math::Vec2f BodyStore::getVelocity(std::size_t index) const {
+        return {velocityX[index], velocityY[index]};
+    }
+
+    /**
+     * @brief Sets the position of a body.
+     * @param index
+     *          The index of the body.
+     * @param newPos
+     *          The new position.
+     */
+    void BodyStore::setPosition(std::size_t index, const math::Vec2f& newPos) {
+        positionX[index] = newPos.getX();
+        positionY[index] = newPos.getY();
+    }
+
+    /**
+     * @brief Sets the velocity of a body.
+     * @param index
+     *          The index of the body.
+     * @param newVel
+     *          The new velocity.
+     */
+    void BodyStore::setVelocity(std::size_t index, const math::Vec2f& newVel) {
+        velocityX[index] = newVel.getX();
+        velocityY[index] = newVel.getY();
+    }
+
+    /**
+     * @brief Moves every array into a larger block of the arena.
+     *
+     * The old arrays stay in the arena until the store is cleared, which costs at most the size of the new arrays
+     * since the capacity doubles.
+     * @param newCapacity
+     *          The new capacity.
+     */
+    void BodyStore::grow(std::size_t newCapacity) {
+        relocate(positionX, newCapacity);
+        relocate(positionY, newCapacity);
+        relocate(positionOldX, newCapacity);
+        relocate(positionOldY, newCapacity);
+        relocate(velocityX, newCapacity);
+        relocate(velocityY, newCapacity);
+        relocate(accelerationX, newCapacity);
+        relocate(accelerationY, newCapacity);
+        relocate(radius, newCapacity);
+        relocate(width, newCapacity);
+        relocate(height, newCapacity);
+        relocate(extent, newCapacity);
+        relocate(mass, newCapacity);
+        relocate(shape, newCapacity);
+        relocate(rbEnabled, newCapacity);
+        relocate(integrationGroups, newCapacity);
+        relocate(integration, newCapacity);
+        relocate(asleep, newCapacity);
+        relocate(sleepFrames, newCapacity);
+        relocate(sleepNext, newCapacity);
+        capacity = newCapacity;
+
+        // Nothing points into a loaded snapshot any more.
+        snapshot.close();
+    }
+
+    /**
+     * @brief Moves one array into a larger block of the arena.
+     * @tparam T
+     *          The element type.
+     * @param array
+     *          The array, updated to point to the new block.
+     * @param newCapacity
+     *          The new capacity.
+     */
+    template<typename T>
+    void BodyStore::relocate(T*& array, std::size_t newCapacity) {
+        T* moved{arena.allocateArray<T>(newCapacity)};
+        if (count > 0) {
+            std::memcpy(moved, array, sizeof(T) * count);
+        }
+        array = moved;
+    }
+} // namespace physx::dynamic
@@ -0,0 +1,221 @@
+/**
+ * @file ConstraintStore.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/dynamic/ConstraintStore.hpp"
+
+#include <algorithm>
+
+namespace physx::dynamic {
+    /**
+     * @brief Adds a constraint to the store.
+     * @param theType
+     *          The kind of constraint.
+     * @param a
+     *          The index of the first body.
+     * @param b
+     *          The index of the second body, @c noBody for a pin.
+     * @param theLength
+     *          The distance to keep, or the rest length of a spring.
+     * @param theStiffness
+     *          The spring force per unit of stretch, springs only.
+     * @param theDamping
+     *          The spring force per unit of stretching speed, springs only.
+     * @param theAnchorX
+     *          The x-component of the point a pin holds its body to, pins only.
+     * @param theAnchorY
+     *          The y-component of the point a pin holds its body to, pins only.
+     * @return The index of the new constraint.
+     */
+    std::size_t ConstraintStore::add(ConstraintType theType, std::uint32_t a, std::uint32_t b, math::f32 theLength,
+                                     math::f32 theStiffness, math::f32 theDamping, math::f32 theAnchorX,
+                                     math::f32 theAnchorY) {
+        type.push_back(theType);
+        bodyA.push_back(a);
+        bodyB.push_back(theType == ConstraintType::Pin ? noBody : b);
+        length.push_back(std::max(theLength, 0.f));
+        stiffness.push_back(theStiffness);
+        damping.push_back(theDamping);
+        anchorX.push_back(theAnchorX);
+        anchorY.push_back(theAnchorY);
+        impulse.push_back(0.f);
+        colorsValid = false;
+        return type.size() - 1;
+    }
+
+    /**
+     * @brief Removes every constraint on a body, keeping the others in order.
+     * @param body
+     *          The index of the body.
+     */
+    void ConstraintStore::removeBody(std::uint32_t body) {
+        std::size_t kept{0};
+        for (std::size_t i{0}; i < type.size(); ++i) {
+            if (bodyA[i] == body || bodyB[i] == body) {
+                continue;
+            }
+
+            type[kept] = type[i];
+            bodyA[kept] = bodyA[i];
+            bodyB[kept] = bodyB[i];
+            length[kept] = length[i];
+            stiffness[kept] = stiffness[i];
+            damping[kept] = damping[i];
+            anchorX[kept] = anchorX[i];
+            anchorY[kept] = anchorY[i];
+            impulse[kept] = impulse[i];
+            ++kept;
+        }
+
+        if (kept != type.size()) {
+            type.resize(kept);
+            bodyA.resize(kept);
+            bodyB.resize(kept);
+            length.resize(kept);
+            stiffness.resize(kept);
+            damping.resize(kept);
+            anchorX.resize(kept);
+            anchorY.resize(kept);
+            impulse.resize(kept);
+            colorsValid = false;
+        }
+    }
+
+    /**
+     * @brief Removes every constraint.
+     */
+    void ConstraintStore::clear() {
+        type.clear();
+        bodyA.clear();
+        bodyB.clear();
+        length.clear();
+        stiffness.clear();
+        damping.clear();
+        anchorX.clear();
+        anchorY.clear();
+        impulse.clear();
+        colorsValid = false;
+    }
+
+    /**
+     * @brief Gets the number of constraints.
+     * @return The constraint count.
+     */
+    std::size_t ConstraintStore::size() const {
+        return type.size();
+    }
+
+    /**
+     * @brief Checks whether the coloring matches the constraints.
+     * @return False if constraints were added or removed since @c buildColors.
+     */
+    bool ConstraintStore::hasColors() const {
+        return colorsValid;
+    }
+
+    /**
+     * @brief Colors the constraints so that no two of a color share a body.
+     *
+     * Each constraint, in order, takes the lowest color not yet used on either of its bodies. A constraint whose
+     * bodies have used up every color goes to the serial color instead.
+     */
+    void ConstraintStore::buildColors() {
+        const std::size_t count{type.size()};
+        std::uint32_t bodyCount{0};
+        for (std::size_t i{0}; i < count; ++i) {
+            bodyCount = std::max(bodyCount, bodyA[i] + 1);
+            if (bodyB[i] != noBody) {
+                bodyCount = std::max(bodyCount, bodyB[i] + 1);
+            }
+        }
+        bodyColors.assign(bodyCount, 0);
+
+        std::vector<std::uint8_t> colors(count);
+        std::size_t colorCount{0};
+        hasOverflow = false;
+        for (std::size_t i{0}; i < count; ++i) {
+            std::uint64_t used{bodyColors[bodyA[i]]};
+            if (bodyB[i] != noBody) {
+                used |= bodyColors[bodyB[i]];
+            }
+            if (used == ~std::uint64_t{0}) {
+                colors[i] = maxColors;
+                hasOverflow = true;
+                continue;
+            }
+
+            std::size_t color{0};
+            while ((used >> color) & 1) {
+                ++color;
+            }
+            colors[i] = static_cast<std::uint8_t>(color);
+            colorCount = std::max(colorCount, color + 1);
+            bodyColors[bodyA[i]] |= std::uint64_t{1} << color;
+            if (bodyB[i] != noBody) {
+                bodyColors[bodyB[i]] |= std::uint64_t{1} << color;
+            }
+        }
+        if (hasOverflow) {
+            for (auto& color : colors) {
+                color = color == maxColors ? static_cast<std::uint8_t>(colorCount) : color;
+            }
+            ++colorCount;
+        }
+
+        colorStart.assign(colorCount + 1, 0);
+        for (std::size_t i{0}; i < count; ++i) {
+            ++colorStart[colors[i] + 1];
+        }
+        for (std::size_t color{0}; color < colorCount; ++color) {
+            colorStart[color + 1] += colorStart[color];
+        }
+
+        order.resize(count);
+        std::vector<std::uint32_t> fill(colorStart.begin(), colorStart.end() - 1);
+        for (std::size_t i{0}; i < count; ++i) {
+            order[fill[colors[i]]++] = static_cast<std::uint32_t>(i);
+        }
+        colorsValid = true;
+    }
+
+    /**
+     * @brief Gets the number of colors, see @c buildColors.
+     * @return The color count.
+     */
+    std::size_t ConstraintStore::getColorCount() const {
+        return colorStart.empty() ? 0 : colorStart.size() - 1;
+    }
+
+    /**
+     * @brief Gets the offset of the first constraint of a color in @c getOrder.
+     * @param color
+     *          The color.
+     * @return The offset.
+     */
+    std::size_t ConstraintStore::getColorBegin(std::size_t color) const {
+        return colorStart[color];
+    }
+
+    /**
+     * @brief Gets the offset one past the last constraint of a color in @c getOrder.
+     * @param color
+     *          The color.
+     * @return The offset.
+     */
+    std::size_t ConstraintStore::getColorEnd(std::size_t color) const {
+        return colorStart[color + 1];
+    }
+
+    /**
+     * @brief Checks whether the constraints of a color share no bodies, so that they can be solved in parallel.
+     * @param color
+     *          The color.
+     * @return False for the serial color.
+     */
+    bool ConstraintStore::isColorParallel(std::size_t color) const {
+        return !hasOverflow || color + 1 < getColorCount();
+    }
+} // namespace physx::dynamic
@@ -7,6 +7,9 @@
 
 #include "../../include/physx/dynamic/RigidBody2D.hpp"
 
+#include "../../include/physx/dynamic/Integrators.hpp"
+#include "../../include/physx/utilities/Lanes.hpp"
+
 namespace physx::dynamic {
     /**
      * @brief @c RigidBody2D constructor.
@@ -58,20 +61,41 @@ namespace physx::dynamic {
         acceleration += accel;
     }
 
-    void RigidBody2D::integrateVerlet(math::f32 dt) {
-        velocity = position - positionOld;
-        positionOld = position;
-
-        position = position + velocity + acceleration * dt * dt;
+    /**
+     * @brief Advances the @c RigidBody2D one step with an integration policy and clears its acceleration.
+     * @tparam Integrator
+     *          The integration policy, see @c Integrators.hpp.
+     * @param dt
+     *          The time step.
+     */
+    template<typename Integrator>
+    void RigidBody2D::integrate(math::f32 dt) {
+        math::f32 x{position.getX()};
+        math::f32 y{position.getY()};
+        math::f32 oldX{positionOld.getX()};
+        math::f32 oldY{positionOld.getY()};
+        math::f32 velX{velocity.getX()};
+        math::f32 velY{velocity.getY()};
+
+        Integrator::template step<utils::ScalarLanes>(x, oldX, velX, acceleration.getX(), dt);
+        Integrator::template step<utils::ScalarLanes>(y, oldY, velY, acceleration.getY(), dt);
+
+        position = {x, y};
+        positionOld = {oldX, oldY};
+        velocity = {velX, velY};
         acceleration = math::Vec2f::zero();
     }
 
-    void RigidBody2D::integrateEuler(math::f32 dt) {
+    void RigidBody2D::integrateVerlet(math::f32 dt) {
+        integrate<VerletIntegrator>(dt);
+    }
 
+    void RigidBody2D::integrateEuler(math::f32 dt) {
+        integrate<EulerIntegrator>(dt);
     }
 
     void RigidBody2D::integrateRK4(math::f32 dt) {
-
+        integrate<RK4Integrator>(dt);
     }
 
     /**
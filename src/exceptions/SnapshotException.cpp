@@ -0,0 +1,36 @@
+/**
+ * @file SnapshotException.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/exceptions/SnapshotException.hpp"
+
+namespace physx::except {
+    /**
+     * @brief @c SnapshotException constructor.
+     * @param message
+     *          The exception message.
+     */
+    SnapshotException::SnapshotException(const char* message)
+        : message{message} {
+    }
+
+    /**
+     * @brief @c SnapshotException constructor.
+     * @param message
+     *          The exception message.
+     */
+    SnapshotException::SnapshotException(const std::string& message)
+        : message{message} {
+    }
+
+    /**
+     * @brief @c Gets the exception message.
+     * @return The exception message.
+     */
+    const char* SnapshotException::what() const noexcept {
+        return message.c_str();
+    }
+}
\ No newline at end of file
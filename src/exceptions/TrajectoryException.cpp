@@ -0,0 +1,36 @@
+/**
+ * @file TrajectoryException.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/exceptions/TrajectoryException.hpp"
+
+namespace physx::except {
+    /**
+     * @brief @c TrajectoryException constructor.
+     * @param message
+     *          The exception message.
+     */
+    TrajectoryException::TrajectoryException(const char* message)
+        : message{message} {
+    }
+
+    /**
+     * @brief @c TrajectoryException constructor.
+     * @param message
+     *          The exception message.
+     */
+    TrajectoryException::TrajectoryException(const std::string& message)
+        : message{message} {
+    }
+
+    /**
+     * @brief @c Gets the exception message.
+     * @return The exception message.
+     */
+    const char* TrajectoryException::what() const noexcept {
+        return message.c_str();
+    }
+}
\ No newline at end of file
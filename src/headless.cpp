@@ -0,0 +1,142 @@
+/**
+ * @file headless.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <llog/llog.hpp>
+#include <memory>
+#include <string>
+
+#include "../include/physx/core/InputLog.hpp"
+#include "../include/physx/core/SceneLoader.hpp"
+#include "../include/physx/core/Simulation.hpp"
+#include "../include/physx/utilities/RandomNumberGenerator.hpp"
+#include "../include/physx/utilities/TrajectoryRecorder.hpp"
+
+/**
+ * @brief Steps a scene without a window and reports the step rate.
+ *
+ * Usage: physx_headless <scene-file> <steps> [options]
+ *
+ * - @c --dt <seconds> - the step size, 1/60 by default.
+ * - @c --replay <input-log> - adds the logged spawns before their steps, and takes the seed and step size from the
+ *   log, reproducing the recorded run bit for bit.
+ * - @c --snapshot <path> - saves a snapshot of the bodies after the last step.
+ * - @c --trajectory <path> - records the positions after every step.
+ * - @c --trace <path> - writes the trace of the last steps as text, when built with @c PHYSX_TRACING.
+ *
+ * When built with @c PHYSX_PROFILING, the time per phase and the counters of the last steps are reported too.
+ */
+int main(int argc, char** argv) {
+    if (argc < 3 || argc % 2 == 0) {
+        LLOG_ERROR("Usage: {} <scene-file> <steps> [--dt <seconds>] [--replay <input-log>] [--snapshot <path>] "
+                   "[--trajectory <path>] [--trace <path>]", argv[0])
+        return EXIT_FAILURE;
+    }
+
+    const std::string scenePath{argv[1]};
+    const long long steps{std::atoll(argv[2])};
+    physx::math::f32 dt{1.f / 60.f};
+    std::string replayPath, snapshotPath, trajectoryPath, tracePath;
+
+    for (int i{3}; i + 1 < argc; i += 2) {
+        const std::string option{argv[i]};
+        if (option == "--dt") {
+            dt = static_cast<physx::math::f32>(std::atof(argv[i + 1]));
+        } else if (option == "--replay") {
+            replayPath = argv[i + 1];
+        } else if (option == "--snapshot") {
+            snapshotPath = argv[i + 1];
+        } else if (option == "--trajectory") {
+            trajectoryPath = argv[i + 1];
+        } else if (option == "--trace") {
+            tracePath = argv[i + 1];
+        } else {
+            LLOG_ERROR("Unknown option {}.", option)
+            return EXIT_FAILURE;
+        }
+    }
+
+    physx::core::Simulation simulation;
+    physx::core::InputLog inputLog;
+    std::unique_ptr<physx::utils::TrajectoryRecorder> recorder;
+    try {
+        physx::core::SceneLoader::load(scenePath, simulation);
+        if (!replayPath.empty()) {
+            inputLog.load(replayPath);
+            physx::utils::RNG::seed(inputLog.getSeed());
+            dt = inputLog.getStepSize();
+        }
+        if (!trajectoryPath.empty()) {
+            recorder = std::make_unique<physx::utils::TrajectoryRecorder>(trajectoryPath);
+        }
+    } catch (const std::exception& e) {
+        LLOG_ERROR("{}", e.what())
+        return EXIT_FAILURE;
+    }
+
+    if (steps <= 0 || dt <= 0.f) {
+        LLOG_ERROR("Steps and dt must be positive.")
+        return EXIT_FAILURE;
+    }
+
+    const auto& store{simulation.getBodies()};
+    const auto start{std::chrono::steady_clock::now()};
+    for (long long step{0}; step < steps; ++step) {
+        inputLog.apply(simulation);
+        simulation.update(dt);
+        if (recorder != nullptr) {
+            recorder->record(store.getPositionX(), store.getPositionY(), store.size());
+        }
+    }
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+
+    const auto bodies{simulation.getBodies().size()};
+    const double stepsPerSecond{static_cast<double>(steps) / elapsed.count()};
+    const double nsPerBodyStep{bodies > 0 ? elapsed.count() * 1e9 / (static_cast<double>(steps) * bodies) : 0.0};
+
+    LLOG_INFO("{} steps of {} bodies on {} threads in {}s", steps, bodies, simulation.getThreadCount(),
+              elapsed.count())
+    LLOG_INFO("{} steps/s, {} ns/body/step", stepsPerSecond, nsPerBodyStep)
+
+#if defined(PHYSX_PROFILING)
+    const physx::utils::Profiler& profiler{simulation.getProfiler()};
+    for (std::size_t i{0}; i < physx::utils::profilePhaseCount; ++i) {
+        const auto phase{static_cast<physx::utils::ProfilePhase>(i)};
+        const physx::utils::ProfileStats stats{profiler.getPhase(phase)};
+        LLOG_INFO("{}: {} ms mean, {} ms max", physx::utils::Profiler::getName(phase), stats.mean, stats.max)
+    }
+    for (std::size_t i{0}; i < physx::utils::profileCounterCount; ++i) {
+        const auto counter{static_cast<physx::utils::ProfileCounter>(i)};
+        LLOG_INFO("{}: {} mean", physx::utils::Profiler::getName(counter), profiler.getCounter(counter).mean)
+    }
+#endif
+
+    try {
+        if (recorder != nullptr) {
+            recorder->close();
+        }
+        if (!snapshotPath.empty()) {
+            simulation.saveSnapshot(snapshotPath);
+        }
+        if (!tracePath.empty()) {
+            std::ofstream trace{tracePath};
+            simulation.getTracer().dump(trace);
+            if (!trace) {
+                LLOG_ERROR("Failed to write trace {}.", tracePath)
+                return EXIT_FAILURE;
+            }
+        }
+    } catch (const std::exception& e) {
+        LLOG_ERROR("{}", e.what())
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file Arena.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/utilities/Arena.hpp"
+
+#include <cstdint>
+
+namespace physx::utils {
+    /**
+     * @brief @c Arena constructor.
+     * @param slabSize
+     *          The size in bytes of each slab. Larger allocations get a slab of their own.
+     */
+    Arena::Arena(std::size_t slabSize)
+        : slabSize{slabSize} {
+    }
+
+    /**
+     * @brief Allocates memory from the current slab, moving on to the next slab (or a new one) when it is full.
+     * @param bytes
+     *          The number of bytes.
+     * @param alignment
+     *          The alignment of the memory, a power of two.
+     * @return The memory.
+     */
+    void* Arena::allocate(std::size_t bytes, std::size_t alignment) {
+        for (; current < slabs.size(); ++current, offset = 0) {
+            const auto base{reinterpret_cast<std::uintptr_t>(slabs[current].memory.get())};
+            const std::uintptr_t aligned{(base + offset + alignment - 1) & ~(alignment - 1)};
+            if (aligned + bytes <= base + slabs[current].size) {
+                offset = aligned + bytes - base;
+                return reinterpret_cast<void*>(aligned);
+            }
+        }
+
+        const std::size_t size{std::max(slabSize, bytes + alignment)};
+        slabs.push_back({std::unique_ptr<std::byte[]>{new std::byte[size]}, size});
+        current = slabs.size() - 1;
+        offset = 0;
+        return allocate(bytes, alignment);
+    }
+
+    /**
+     * @brief Rewinds every slab so its memory is handed out again. Existing allocations become invalid.
+     */
+    void Arena::reset() {
+        current = 0;
+        offset = 0;
+    }
+
+    /**
+     * @brief Frees every slab. Existing allocations become invalid.
+     */
+    void Arena::release() {
+        slabs.clear();
+        reset();
+    }
+
+    /**
+     * @brief Gets the number of slabs the arena holds.
+     * @return The slab count.
+     */
+    std::size_t Arena::getSlabCount() const {
+        return slabs.size();
+    }
+
+    /**
+     * @brief Gets the total size of the slabs the arena holds.
+     * @return The size in bytes.
+     */
+    std::size_t Arena::getReservedBytes() const {
+        std::size_t total{0};
+        for (const auto& slab : slabs) {
+            total += slab.size;
+        }
+        return total;
+    }
+} // namespace physx::utils
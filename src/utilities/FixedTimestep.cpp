@@ -0,0 +1,129 @@
+/**
+ * @file FixedTimestep.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/utilities/FixedTimestep.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace physx::utils {
+    /**
+     * @brief @c FixedTimestep constructor.
+     * @param rate
+     *          The number of physics steps per second, raised to a small positive minimum if it is not positive.
+     * @param subSteps
+     *          The number of sub-steps each physics step is split into.
+     * @param maxStepsPerFrame
+     *          The most physics steps a single frame may catch up on.
+     */
+    FixedTimestep::FixedTimestep(math::f32 rate, std::size_t subSteps, std::size_t maxStepsPerFrame)
+        : stepSize{toStepSize(rate)},
+          subSteps{std::max<std::size_t>(subSteps, 1)},
+          maxStepsPerFrame{std::max<std::size_t>(maxStepsPerFrame, 1)} {
+    }
+
+    /**
+     * @brief Adds a frame's elapsed time and returns how many physics steps are due.
+     * @param frameTime
+     *          The elapsed time of the frame in seconds.
+     * @return The number of physics steps to run, at most the per-frame cap.
+     */
+    std::size_t FixedTimestep::advance(math::f32 frameTime) {
+        accumulator += std::max(frameTime, 0.f);
+
+        std::size_t steps{0};
+        while (accumulator >= stepSize && steps < maxStepsPerFrame) {
+            accumulator -= stepSize;
+            ++steps;
+        }
+
+        ///< Drop whole steps that could not be caught up on this frame.
+        if (accumulator >= stepSize) {
+            accumulator = std::fmod(accumulator, stepSize);
+        }
+
+        return steps;
+    }
+
+    /**
+     * @brief Discards any accumulated time.
+     */
+    void FixedTimestep::reset() {
+        accumulator = 0.f;
+    }
+
+    /**
+     * @brief Sets the number of physics steps per second.
+     * @param newRate
+     *          The new rate, raised to a small positive minimum if it is not positive.
+     */
+    void FixedTimestep::setRate(math::f32 newRate) {
+        stepSize = toStepSize(newRate);
+        accumulator = std::min(accumulator, stepSize);
+    }
+
+    /**
+     * @brief Sets the number of sub-steps each physics step is split into.
+     * @param newSubSteps
+     *          The new number of sub-steps.
+     */
+    void FixedTimestep::setSubSteps(std::size_t newSubSteps) {
+        subSteps = std::max<std::size_t>(newSubSteps, 1);
+    }
+
+    /**
+     * @brief Sets the most physics steps a single frame may catch up on.
+     * @param newMaxStepsPerFrame
+     *          The new cap.
+     */
+    void FixedTimestep::setMaxStepsPerFrame(std::size_t newMaxStepsPerFrame) {
+        maxStepsPerFrame = std::max<std::size_t>(newMaxStepsPerFrame, 1);
+    }
+
+    /**
+     * @brief Gets the length of a physics step.
+     * @return The step size in seconds.
+     */
+    math::f32 FixedTimestep::getStepSize() const {
+        return stepSize;
+    }
+
+    /**
+     * @brief Gets the length of a sub-step, the @c dt passed to @c Simulation::update.
+     * @return The sub-step size in seconds.
+     */
+    math::f32 FixedTimestep::getSubStepSize() const {
+        return stepSize / static_cast<math::f32>(subSteps);
+    }
+
+    /**
+     * @brief Gets the number of sub-steps each physics step is split into.
+     * @return The number of sub-steps.
+     */
+    std::size_t FixedTimestep::getSubSteps() const {
+        return subSteps;
+    }
+
+    /**
+     * @brief Gets how far the accumulated time is into the next physics step.
+     * @return A value in [0, 1], usable to interpolate rendering between steps.
+     */
+    math::f32 FixedTimestep::getAlpha() const {
+        return std::min(accumulator / stepSize, 1.f);
+    }
+
+    /**
+     * @brief Turns a rate into a step size. A rate of zero would give an infinite step and a negative one a
+     * negative step, so rates below @c minRate (and NaN) are raised to it.
+     * @param rate
+     *          The number of physics steps per second.
+     * @return The step size in seconds.
+     */
+    math::f32 FixedTimestep::toStepSize(math::f32 rate) {
+        return 1.f / (rate >= minRate ? rate : minRate);
+    }
+} // namespace physx::utils
@@ -0,0 +1,125 @@
+/**
+ * @file MappedFile.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/utilities/MappedFile.hpp"
+
+#include <fstream>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define PHYSX_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace physx::utils {
+    /**
+     * @brief @c MappedFile destructor.
+     */
+    MappedFile::~MappedFile() {
+        close();
+    }
+
+    /**
+     * @brief @c MappedFile move constructor.
+     * @param other
+     *          The @c MappedFile to take the view from.
+     */
+    MappedFile::MappedFile(MappedFile&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    /**
+     * @brief @c MappedFile move assignment operator.
+     * @param other
+     *          The @c MappedFile to take the view from.
+     * @return This @c MappedFile.
+     */
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            data = std::exchange(other.data, nullptr);
+            size = std::exchange(other.size, 0);
+            mapped = std::exchange(other.mapped, false);
+            buffer = std::move(other.buffer);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Opens a view of a file, closing any view already open.
+     * @param path
+     *          The path of the file.
+     * @return @c true if the file was opened.
+     */
+    bool MappedFile::open(const std::string& path) {
+        close();
+
+#if defined(PHYSX_HAS_MMAP)
+        const int descriptor{::open(path.c_str(), O_RDONLY)};
+        if (descriptor < 0) {
+            return false;
+        }
+
+        struct stat status{};
+        if (::fstat(descriptor, &status) != 0) {
+            ::close(descriptor);
+            return false;
+        }
+
+        if (status.st_size > 0) {
+            void* view{::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                              descriptor, 0)};
+            if (view == MAP_FAILED) {
+                ::close(descriptor);
+                return false;
+            }
+            data = static_cast<std::byte*>(view);
+            size = static_cast<std::size_t>(status.st_size);
+            mapped = true;
+        }
+
+        // The mapping keeps the file alive on its own.
+        ::close(descriptor);
+        return true;
+#else
+        std::ifstream file{path, std::ios::binary | std::ios::ate};
+        if (!file) {
+            return false;
+        }
+
+        buffer.resize(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()))) {
+            buffer.clear();
+            return false;
+        }
+
+        data = buffer.data();
+        size = buffer.size();
+        return true;
+#endif
+    }
+
+    /**
+     * @brief Closes the view. Pointers into it must not be used afterwards.
+     */
+    void MappedFile::close() {
+#if defined(PHYSX_HAS_MMAP)
+        if (mapped) {
+            ::munmap(data, size);
+        }
+#endif
+        data = nullptr;
+        size = 0;
+        mapped = false;
+        buffer.clear();
+        buffer.shrink_to_fit();
+    }
+} // namespace physx::utils
@@ -0,0 +1,187 @@
+/**
+ * @file Profiler.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/utilities/Profiler.hpp"
+
+#include <algorithm>
+
+#include "../../include/physx/utilities/ThreadPool.hpp"
+
+namespace physx::utils {
+    namespace {
+        const char* phaseNames[profilePhaseCount]{"step", "integrate", "constraints", "gravity", "broadphase",
+                                                  "narrowphase", "solve", "sleep"};
+        const char* counterNames[profileCounterCount]{"bodies integrated", "pairs tested", "contacts",
+                                                      "sleeping bodies"};
+    } // namespace
+
+    /**
+     * @brief @c Profiler constructor.
+     * @param windowSize
+     *          The number of steps the aggregates cover.
+     */
+    Profiler::Profiler(std::size_t windowSize)
+        : window(std::max<std::size_t>(windowSize, 1)),
+          threadCounters(1) {
+    }
+
+    /**
+     * @brief Sets the number of threads that may call @c addFromThread, see @c ThreadPool::getThreadIndex.
+     * @param threadCount
+     *          The thread count.
+     */
+    void Profiler::setThreadCount(std::size_t threadCount) {
+        threadCounters.assign(std::max<std::size_t>(threadCount, 1), ThreadCounters{});
+    }
+
+    /**
+     * @brief Sets the number of steps the aggregates cover, dropping the steps recorded so far.
+     * @param windowSize
+     *          The number of steps.
+     */
+    void Profiler::setWindowSize(std::size_t windowSize) {
+        window.assign(std::max<std::size_t>(windowSize, 1), Sample{});
+        reset();
+    }
+
+    /**
+     * @brief Drops every recorded step.
+     */
+    void Profiler::reset() {
+        next = 0;
+        filled = 0;
+        current = {};
+        std::fill(threadCounters.begin(), threadCounters.end(), ThreadCounters{});
+    }
+
+    /**
+     * @brief Adds time to a phase of the current step.
+     * @param phase
+     *          The phase.
+     * @param duration
+     *          The time spent.
+     */
+    void Profiler::addTime(ProfilePhase phase, std::chrono::steady_clock::duration duration) {
+        current.times[static_cast<std::size_t>(phase)] +=
+                std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    }
+
+    /**
+     * @brief Adds to a counter of the current step. Only for the thread that steps the simulation.
+     * @param counter
+     *          The counter.
+     * @param value
+     *          The amount to add.
+     */
+    void Profiler::add(ProfileCounter counter, std::uint64_t value) {
+        current.counters[static_cast<std::size_t>(counter)] += value;
+    }
+
+    /**
+     * @brief Adds to a counter of the current step from inside a @c ThreadPool loop.
+     * @param counter
+     *          The counter.
+     * @param value
+     *          The amount to add.
+     */
+    void Profiler::addFromThread(ProfileCounter counter, std::uint64_t value) {
+        threadCounters[ThreadPool::getThreadIndex()].counters[static_cast<std::size_t>(counter)] += value;
+    }
+
+    /**
+     * @brief Finishes the current step, moving it into the window.
+     */
+    void Profiler::endStep() {
+        for (ThreadCounters& thread : threadCounters) {
+            for (std::size_t i{0}; i < profileCounterCount; ++i) {
+                current.counters[i] += thread.counters[i];
+                thread.counters[i] = 0;
+            }
+        }
+
+        window[next] = current;
+        next = (next + 1) % window.size();
+        filled = std::min(filled + 1, window.size());
+        current = {};
+    }
+
+    /**
+     * @brief Gets the time spent in a phase over the window.
+     * @param phase
+     *          The phase.
+     * @return The mean, maximum and latest time per step in milliseconds.
+     */
+    ProfileStats Profiler::getPhase(ProfilePhase phase) const {
+        return aggregate([phase](const Sample& sample) {
+            return static_cast<math::f64>(sample.times[static_cast<std::size_t>(phase)]) * 1e-6;
+        });
+    }
+
+    /**
+     * @brief Gets a counter over the window.
+     * @param counter
+     *          The counter.
+     * @return The mean, maximum and latest value per step.
+     */
+    ProfileStats Profiler::getCounter(ProfileCounter counter) const {
+        return aggregate([counter](const Sample& sample) {
+            return static_cast<math::f64>(sample.counters[static_cast<std::size_t>(counter)]);
+        });
+    }
+
+    /**
+     * @brief Gets the number of steps the aggregates currently cover.
+     * @return The number of steps.
+     */
+    std::size_t Profiler::getSampleCount() const {
+        return filled;
+    }
+
+    /**
+     * @brief Gets a readable name for a phase.
+     * @param phase
+     *          The phase.
+     * @return The name.
+     */
+    const char* Profiler::getName(ProfilePhase phase) {
+        return phaseNames[static_cast<std::size_t>(phase)];
+    }
+
+    /**
+     * @brief Gets a readable name for a counter.
+     * @param counter
+     *          The counter.
+     * @return The name.
+     */
+    const char* Profiler::getName(ProfileCounter counter) {
+        return counterNames[static_cast<std::size_t>(counter)];
+    }
+
+    /**
+     * @brief Aggregates one value of every sample in the window.
+     * @tparam Value
+     *          Callable that extracts the value from a @c Sample.
+     * @param value
+     *          The extractor.
+     * @return The mean, maximum and latest value, all zero if nothing was recorded.
+     */
+    template<typename Value>
+    ProfileStats Profiler::aggregate(Value value) const {
+        if (filled == 0) {
+            return {0.0, 0.0, 0.0};
+        }
+
+        ProfileStats stats{0.0, 0.0, value(window[(next + window.size() - 1) % window.size()])};
+        for (std::size_t i{0}; i < filled; ++i) {
+            const math::f64 sample{value(window[i])};
+            stats.mean += sample;
+            stats.max = std::max(stats.max, sample);
+        }
+        stats.mean /= static_cast<math::f64>(filled);
+        return stats;
+    }
+} // namespace physx::utils
@@ -7,24 +7,69 @@
 
 #include "../../include/physx/utilities/RandomNumberGenerator.hpp"
 
+#include <random>
+
 namespace physx::utils {
     /**
-     * @brief Generates a random integer between two values.
+     * @brief @c RandomNumberGenerator constructor.
+     * @param seed
+     *          The seed of the stream.
+     */
+    RandomNumberGenerator::RandomNumberGenerator(std::uint64_t seed)
+        : state{seed} {
+    }
+
+    /**
+     * @brief Generates the next 64 random bits of the stream.
+     * @return The random bits.
+     */
+    std::uint64_t RandomNumberGenerator::next() {
+        std::uint64_t z{state += 0x9E3779B97F4A7C15ULL};
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief Generates a random floating-point number in [min, max).
+     * @param min
+     *          The minimum value.
+     * @param max
+     *          The maximum value.
+     * @return A random floating-point number.
+     */
+    math::f32 RandomNumberGenerator::nextFloat(math::f32 min, math::f32 max) {
+        const math::f32 unit{static_cast<math::f32>(next() >> 40) * 0x1.0p-24f};
+        return min + (max - min) * unit;
+    }
+
+    /**
+     * @brief Generates a random integer in [min, max].
      * @param min
      *          The minimum value.
      * @param max
      *          The maximum value.
      * @return A random integer.
      */
-    int RandomNumberGenerator::random(math::i32 min, math::i32 max) {
-        std::random_device rd;
-        std::mt19937 mt{rd()};
-        std::uniform_int_distribution<math::i32> dist(min, max);
-        return dist(mt);
+    math::i32 RandomNumberGenerator::nextInt(math::i32 min, math::i32 max) {
+        const std::uint64_t range{static_cast<std::uint64_t>(static_cast<math::i64>(max) - min + 1)};
+        return static_cast<math::i32>(min + static_cast<math::i64>(((next() >> 32) * range) >> 32));
     }
 
     /**
-     * @brief Generates a random floating-point number between two values.
+     * @brief Generates a random integer between two values from the shared stream.
+     * @param min
+     *          The minimum value.
+     * @param max
+     *          The maximum value.
+     * @return A random integer.
+     */
+    math::i32 RandomNumberGenerator::random(math::i32 min, math::i32 max) {
+        return shared().nextInt(min, max);
+    }
+
+    /**
+     * @brief Generates a random floating-point number between two values from the shared stream.
      * @param min
      *          The minimum value.
      * @param max
@@ -32,9 +77,25 @@ namespace physx::utils {
      * @return A random floating-point number.
      */
     math::f32 RandomNumberGenerator::random(math::f32 min, math::f32 max) {
-        std::random_device rd;
-        std::mt19937 mt{rd()};
-        std::uniform_real_distribution<math::f32> dist(min, max);
-        return dist(mt);
+        return shared().nextFloat(min, max);
+    }
+
+    /**
+     * @brief Restarts the shared stream from a seed, making every following @c random call reproducible.
+     * @param seed
+     *          The seed.
+     */
+    void RandomNumberGenerator::seed(std::uint64_t seed) {
+        shared() = RandomNumberGenerator{seed};
+    }
+
+    /**
+     * @brief Gets the shared stream, seeding it from @c std::random_device on first use.
+     * @return The shared stream.
+     */
+    RandomNumberGenerator& RandomNumberGenerator::shared() {
+        static RandomNumberGenerator generator{(static_cast<std::uint64_t>(std::random_device{}()) << 32) ^
+                                               std::random_device{}()};
+        return generator;
     }
-} // namespace physx::utils
\ No newline at end of file
+} // namespace physx::utils
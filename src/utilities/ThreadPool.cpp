@@ -0,0 +1,138 @@
+/**
+ * @file ThreadPool.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/utilities/ThreadPool.hpp"
+
+#include <algorithm>
+
+namespace physx::utils {
+    namespace {
+        thread_local std::size_t threadIndex{0};    ///< Zero on every thread that is not a pool worker.
+    } // namespace
+
+    /**
+     * @brief @c ThreadPool constructor.
+     * @param threadCount
+     *          The total number of threads taking part in a loop, including the caller.
+     */
+    ThreadPool::ThreadPool(std::size_t threadCount) {
+        for (std::size_t i{1}; i < std::max<std::size_t>(threadCount, 1); ++i) {
+            workers.emplace_back(&ThreadPool::workerLoop, this, i);
+        }
+    }
+
+    /**
+     * @brief @c ThreadPool destructor.
+     */
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stopping = true;
+        }
+        wake.notify_all();
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Runs a function over the range [0, count) split across the pool.
+     *
+     * Returns once every sub-range has been processed.
+     * @param count
+     *          The size of the range.
+     * @param function
+     *          Called with each [begin, end) sub-range.
+     */
+    void ThreadPool::parallelFor(std::size_t count, const RangeFunction& function) {
+        if (count == 0) {
+            return;
+        }
+
+        if (workers.empty()) {
+            function(0, count);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            job = &function;
+            jobCount = count;
+            chunkSize = std::max<std::size_t>(1, count / (getThreadCount() * 4));
+            nextChunk.store(0, std::memory_order_relaxed);
+            activeWorkers = workers.size();
+            ++generation;
+        }
+        wake.notify_all();
+
+        runChunks();
+
+        std::unique_lock<std::mutex> lock{mutex};
+        finished.wait(lock, [this] { return activeWorkers == 0; });
+        job = nullptr;
+    }
+
+    /**
+     * @brief Gets the number of threads taking part in a loop, including the caller.
+     * @return The thread count.
+     */
+    std::size_t ThreadPool::getThreadCount() const {
+        return workers.size() + 1;
+    }
+
+    /**
+     * @brief Gets the index of the calling thread within its pool, from zero for the thread that calls
+     * @c parallelFor to @c getThreadCount() - 1. Lets loop bodies write to per-thread buffers.
+     * @return The thread index.
+     */
+    std::size_t ThreadPool::getThreadIndex() {
+        return threadIndex;
+    }
+
+    /**
+     * @brief Waits for loops and helps run them until the pool is destroyed.
+     * @param index
+     *          The index of the worker, from one.
+     */
+    void ThreadPool::workerLoop(std::size_t index) {
+        threadIndex = index;
+        std::uint64_t seen{0};
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                wake.wait(lock, [this, seen] { return stopping || generation != seen; });
+                if (stopping) {
+                    return;
+                }
+                seen = generation;
+            }
+
+            runChunks();
+
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                --activeWorkers;
+            }
+            finished.notify_one();
+        }
+    }
+
+    /**
+     * @brief Claims and runs chunks of the current loop until none are left.
+     */
+    void ThreadPool::runChunks() {
+        while (true) {
+            const std::size_t begin{nextChunk.fetch_add(chunkSize, std::memory_order_relaxed)};
+            if (begin >= jobCount) {
+                return;
+            }
+            (*job)(begin, std::min(begin + chunkSize, jobCount));
+        }
+    }
+} // namespace physx::utils
@@ -0,0 +1,252 @@
+/**
+ * @file Tracer.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/utilities/Tracer.hpp"
+
+#include <algorithm>
+
+#include "../../include/physx/utilities/ThreadPool.hpp"
+
+namespace physx::utils {
+    namespace {
+        const char* eventNames[traceEventCount]{"spawn", "remove", "collision", "phase-begin", "phase-end",
+                                                "constraint-clamp"};
+
+        std::size_t roundUpToPowerOfTwo(std::size_t value) {
+            std::size_t power{1};
+            while (power < value) {
+                power <<= 1;
+            }
+            return power;
+        }
+    } // namespace
+
+    /**
+     * @brief @c Tracer constructor.
+     * @param capacity
+     *          The number of records each thread keeps, rounded up to a power of two.
+     */
+    Tracer::Tracer(std::size_t capacity)
+        : capacity{roundUpToPowerOfTwo(capacity)} {
+        setThreadCount(1);
+    }
+
+    /**
+     * @brief Sets the number of threads that may record, see @c ThreadPool::getThreadIndex. Drops every record.
+     * @param threadCount
+     *          The thread count.
+     */
+    void Tracer::setThreadCount(std::size_t threadCount) {
+        ringCount = std::max<std::size_t>(threadCount, 1);
+        rings = std::make_unique<Ring[]>(ringCount);
+        for (std::size_t i{0}; i < ringCount; ++i) {
+            rings[i].records.resize(capacity);
+        }
+    }
+
+    /**
+     * @brief Sets the number of records each thread keeps. Drops every record.
+     * @param newCapacity
+     *          The record count, rounded up to a power of two.
+     */
+    void Tracer::setCapacity(std::size_t newCapacity) {
+        capacity = roundUpToPowerOfTwo(newCapacity);
+        setThreadCount(ringCount);
+    }
+
+    /**
+     * @brief Switches recording on or off. Records already taken are kept.
+     * @param newEnabled
+     *          Whether to record.
+     */
+    void Tracer::setEnabled(bool newEnabled) {
+        enabled = newEnabled;
+    }
+
+    /**
+     * @brief Checks whether records are being taken.
+     * @return True if recording.
+     */
+    bool Tracer::isEnabled() const {
+        return enabled;
+    }
+
+    /**
+     * @brief Sets the step stamped on the records that follow. Only for the thread that steps the simulation.
+     * @param newStep
+     *          The step number.
+     */
+    void Tracer::setStep(std::uint64_t newStep) {
+        step = static_cast<std::uint32_t>(newStep);
+    }
+
+    /**
+     * @brief Drops every record.
+     */
+    void Tracer::clear() {
+        for (std::size_t i{0}; i < ringCount; ++i) {
+            rings[i].head.store(0, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Records a body being added.
+     * @param index
+     *          The index of the body.
+     * @param shape
+     *          The shape of the body.
+     * @param x
+     *          The x-component of its position.
+     * @param y
+     *          The y-component of its position.
+     */
+    void Tracer::spawn(std::size_t index, std::uint8_t shape, math::f32 x, math::f32 y) {
+        push(TraceEvent::Spawn, shape, static_cast<std::uint32_t>(index), 0, x, y);
+    }
+
+    /**
+     * @brief Records a body being removed.
+     * @param index
+     *          The index of the body.
+     */
+    void Tracer::remove(std::size_t index) {
+        push(TraceEvent::Remove, 0, static_cast<std::uint32_t>(index), 0, 0.f, 0.f);
+    }
+
+    /**
+     * @brief Records two bodies found touching.
+     * @param a
+     *          The index of the first body.
+     * @param b
+     *          The index of the second body.
+     */
+    void Tracer::collision(std::size_t a, std::size_t b) {
+        push(TraceEvent::Collision, 0, static_cast<std::uint32_t>(a), static_cast<std::uint32_t>(b), 0.f, 0.f);
+    }
+
+    /**
+     * @brief Records the start of a step phase, with a time stamp.
+     * @param phase
+     *          The phase.
+     */
+    void Tracer::beginPhase(ProfilePhase phase) {
+        if (enabled) {
+            push(TraceEvent::PhaseBegin, static_cast<std::uint16_t>(phase), 0, 0, 0.f, 0.f, now());
+        }
+    }
+
+    /**
+     * @brief Records the end of a step phase, with a time stamp.
+     * @param phase
+     *          The phase.
+     */
+    void Tracer::endPhase(ProfilePhase phase) {
+        if (enabled) {
+            push(TraceEvent::PhaseEnd, static_cast<std::uint16_t>(phase), 0, 0, 0.f, 0.f, now());
+        }
+    }
+
+    /**
+     * @brief Records a body being pushed back inside the boundary or out of a collider.
+     * @param index
+     *          The index of the body.
+     * @param overshoot
+     *          How far the body was outside the boundary or inside the collider.
+     */
+    void Tracer::constraintClamp(std::size_t index, math::f32 overshoot) {
+        push(TraceEvent::ConstraintClamp, 0, static_cast<std::uint32_t>(index), 0, overshoot, 0.f);
+    }
+
+    /**
+     * @brief Gathers the records still held by every thread, ordered by step. Within a step the records of each
+     * thread keep their order, and threads follow each other by index.
+     * @return The records, oldest step first.
+     */
+    std::vector<TraceRecord> Tracer::collect() const {
+        std::vector<TraceRecord> records;
+        for (std::size_t i{0}; i < ringCount; ++i) {
+            const Ring& ring{rings[i]};
+            const std::uint64_t head{ring.head.load(std::memory_order_acquire)};
+            const std::uint64_t held{std::min<std::uint64_t>(head, capacity)};
+            for (std::uint64_t k{head - held}; k < head; ++k) {
+                records.push_back(ring.records[k & (capacity - 1)]);
+            }
+        }
+
+        std::stable_sort(records.begin(), records.end(), [](const TraceRecord& lhs, const TraceRecord& rhs) {
+            return lhs.step < rhs.step;
+        });
+        return records;
+    }
+
+    /**
+     * @brief Writes the records returned by @c collect as text, one per line.
+     * @param out
+     *          The stream to write to.
+     */
+    void Tracer::dump(std::ostream& out) const {
+        for (const TraceRecord& record : collect()) {
+            out << record.step << ' ' << static_cast<unsigned int>(record.thread) << ' ' << getName(record.event);
+            switch (record.event) {
+                case TraceEvent::Spawn:
+                    out << ' ' << record.a << " shape " << record.detail << " at " << record.x << ' ' << record.y;
+                    break;
+                case TraceEvent::Remove:
+                    out << ' ' << record.a;
+                    break;
+                case TraceEvent::Collision:
+                    out << ' ' << record.a << ' ' << record.b;
+                    break;
+                case TraceEvent::PhaseBegin:
+                case TraceEvent::PhaseEnd:
+                    out << ' ' << Profiler::getName(static_cast<ProfilePhase>(record.detail)) << " at "
+                        << record.time << "ns";
+                    break;
+                case TraceEvent::ConstraintClamp:
+                    out << ' ' << record.a << " by " << record.x;
+                    break;
+            }
+            out << '\n';
+        }
+    }
+
+    /**
+     * @brief Gets the name of an event, as written by @c dump.
+     * @param event
+     *          The event.
+     * @return The name.
+     */
+    const char* Tracer::getName(TraceEvent event) {
+        return eventNames[static_cast<std::size_t>(event)];
+    }
+
+    /**
+     * @brief Appends a record to the ring of the calling thread, overwriting its oldest record when full.
+     */
+    void Tracer::push(TraceEvent event, std::uint16_t detail, std::uint32_t a, std::uint32_t b, math::f32 x,
+                      math::f32 y, std::uint64_t time) {
+        if (!enabled) {
+            return;
+        }
+
+        const std::size_t thread{std::min(ThreadPool::getThreadIndex(), ringCount - 1)};
+        Ring& ring{rings[thread]};
+        const std::uint64_t head{ring.head.load(std::memory_order_relaxed)};
+        ring.records[head & (capacity - 1)] = {time, step, event, static_cast<std::uint8_t>(thread), detail, a, b,
+                                               x, y};
+        ring.head.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Gets the time since the tracer was created.
+     * @return The time in nanoseconds.
+     */
+    std::uint64_t Tracer::now() const {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - epoch).count());
+    }
+} // namespace physx::utils
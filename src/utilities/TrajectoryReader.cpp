@@ -0,0 +1,214 @@
+/**
+ * @file TrajectoryReader.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/utilities/TrajectoryReader.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "../../include/physx/utilities/TrajectoryFormat.hpp"
+
+namespace physx::utils {
+    /**
+     * @brief @c TrajectoryReader constructor. Maps the file and reads its header and index.
+     * @param thePath
+     *          The path of the trajectory file.
+     * @throws except::TrajectoryException
+     *          If the file cannot be read, is not a trajectory, or was not closed by its recorder.
+     */
+    TrajectoryReader::TrajectoryReader(const std::string& thePath)
+        : path{thePath} {
+        if (!file.open(path)) {
+            throw except::TrajectoryException("Cannot open trajectory file " + path + ".");
+        }
+
+        data = reinterpret_cast<const std::uint8_t*>(file.getData());
+        const std::size_t size{file.getSize()};
+        if (size < trajectory::headerSize + trajectory::trailerSize ||
+            !std::equal(std::begin(trajectory::fileMagic), std::end(trajectory::fileMagic), data)) {
+            fail("is not a trajectory");
+        }
+        if (trajectory::readLittleEndian<std::uint32_t>(data + 8) != trajectory::version) {
+            fail("has an unsupported version");
+        }
+
+        keyframeInterval = trajectory::readLittleEndian<std::uint32_t>(data + 12);
+        const auto quantumBits{trajectory::readLittleEndian<std::uint32_t>(data + 16)};
+        std::memcpy(&quantum, &quantumBits, sizeof(quantum));
+
+        const std::uint8_t* trailer{data + size - trajectory::trailerSize};
+        if (!std::equal(std::begin(trajectory::indexMagic), std::end(trajectory::indexMagic), trailer + 8)) {
+            fail("has no index, it was not closed");
+        }
+
+        const auto indexOffset{trajectory::readLittleEndian<std::uint64_t>(trailer)};
+        if (indexOffset < trajectory::headerSize || indexOffset >= size - trajectory::trailerSize ||
+            keyframeInterval == 0) {
+            fail("is corrupt");
+        }
+
+        framesEnd = data + indexOffset;
+
+        const std::uint8_t* index{framesEnd};
+        std::uint64_t storedFrameCount, keyframeCount;
+        if (*index++ != static_cast<std::uint8_t>(trajectory::Chunk::Index) ||
+            !trajectory::readVarint(index, trailer, storedFrameCount) ||
+            !trajectory::readVarint(index, trailer, keyframeCount) ||
+            keyframeCount != (storedFrameCount + keyframeInterval - 1) / keyframeInterval ||
+            keyframeCount > static_cast<std::uint64_t>(trailer - index) / sizeof(std::uint64_t)) {
+            fail("has a corrupt index");
+        }
+
+        frameCount = static_cast<std::size_t>(storedFrameCount);
+        keyframeOffsets.resize(static_cast<std::size_t>(keyframeCount));
+        for (auto& keyframeOffset : keyframeOffsets) {
+            keyframeOffset = trajectory::readLittleEndian<std::uint64_t>(index);
+            index += sizeof(std::uint64_t);
+            if (keyframeOffset < trajectory::headerSize || keyframeOffset >= indexOffset) {
+                fail("has a corrupt index");
+            }
+        }
+
+        position = data + trajectory::headerSize;
+    }
+
+    /**
+     * @brief Moves to a frame, so the next call to @c next returns it.
+     *
+     * Decodes forward from the closest key frame at or before it.
+     * @param target
+     *          The index of the frame, up to @c getFrameCount.
+     * @throws except::TrajectoryException
+     *          If the frame is out of range or the file is corrupt.
+     */
+    void TrajectoryReader::seek(std::size_t target) {
+        if (target > frameCount) {
+            fail("has no frame " + std::to_string(target));
+        }
+
+        if (keyframeOffsets.empty()) {
+            position = data + trajectory::headerSize;
+            frame = 0;
+            return;
+        }
+
+        const std::size_t keyframe{std::min(target / keyframeInterval, keyframeOffsets.size() - 1)};
+        position = data + keyframeOffsets[keyframe];
+        frame = keyframe * keyframeInterval;
+        while (frame < target) {
+            decodeFrame();
+        }
+    }
+
+    /**
+     * @brief Decodes the next frame.
+     * @param x
+     *          Receives the x-components of the positions.
+     * @param y
+     *          Receives the y-components of the positions.
+     * @return @c false if every frame has been read.
+     * @throws except::TrajectoryException
+     *          If the file is corrupt.
+     */
+    bool TrajectoryReader::next(std::vector<math::f32>& x, std::vector<math::f32>& y) {
+        if (frame >= frameCount) {
+            return false;
+        }
+
+        decodeFrame();
+
+        x.resize(currentX.size());
+        y.resize(currentY.size());
+        for (std::size_t i{0}; i < currentX.size(); ++i) {
+            x[i] = static_cast<math::f32>(currentX[i]) * quantum;
+            y[i] = static_cast<math::f32>(currentY[i]) * quantum;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Gets the number of frames in the file.
+     * @return The number of frames.
+     */
+    std::size_t TrajectoryReader::getFrameCount() const {
+        return frameCount;
+    }
+
+    /**
+     * @brief Gets the number of frames between key frames.
+     * @return The key frame interval.
+     */
+    std::size_t TrajectoryReader::getKeyframeInterval() const {
+        return keyframeInterval;
+    }
+
+    /**
+     * @brief Gets the resolution the positions were stored at.
+     * @return The quantum.
+     */
+    math::f32 TrajectoryReader::getQuantum() const {
+        return quantum;
+    }
+
+    /**
+     * @brief Gets the simulation step of the frame last returned by @c next. Steps the recorder dropped leave gaps.
+     * @return The step.
+     */
+    std::uint64_t TrajectoryReader::getStep() const {
+        return step;
+    }
+
+    /**
+     * @brief Applies the frame at @c position to the current positions and moves past it.
+     */
+    void TrajectoryReader::decodeFrame() {
+        if (position >= framesEnd) {
+            fail("is truncated");
+        }
+
+        const std::uint8_t chunk{*position++};
+        std::uint64_t count;
+        if (chunk > static_cast<std::uint8_t>(trajectory::Chunk::KeyFrame) ||
+            !trajectory::readVarint(position, framesEnd, step) ||
+            !trajectory::readVarint(position, framesEnd, count) ||
+            count > static_cast<std::uint64_t>(framesEnd - position) / 2) {
+            fail("has a corrupt frame " + std::to_string(frame));
+        }
+
+        const bool keyframe{chunk == static_cast<std::uint8_t>(trajectory::Chunk::KeyFrame)};
+        if (keyframe) {
+            currentX.assign(static_cast<std::size_t>(count), 0);
+            currentY.assign(static_cast<std::size_t>(count), 0);
+        } else {
+            currentX.resize(static_cast<std::size_t>(count), 0);
+            currentY.resize(static_cast<std::size_t>(count), 0);
+        }
+
+        for (auto* current : {&currentX, &currentY}) {
+            for (std::int32_t& value : *current) {
+                std::uint64_t delta;
+                if (!trajectory::readVarint(position, framesEnd, delta)) {
+                    fail("has a corrupt frame " + std::to_string(frame));
+                }
+                value = static_cast<std::int32_t>(value + trajectory::unzigzag(delta));
+            }
+        }
+
+        ++frame;
+    }
+
+    /**
+     * @brief Throws an exception about the file.
+     * @param reason
+     *          What is wrong with the file.
+     * @throws except::TrajectoryException
+     *          Always.
+     */
+    void TrajectoryReader::fail(const std::string& reason) const {
+        throw except::TrajectoryException("Trajectory " + path + " " + reason + ".");
+    }
+} // namespace physx::utils
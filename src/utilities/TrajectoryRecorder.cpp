@@ -0,0 +1,221 @@
+/**
+ * @file TrajectoryRecorder.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/utilities/TrajectoryRecorder.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <llog/llog.hpp>
+
+#include "../../include/physx/utilities/TrajectoryFormat.hpp"
+
+namespace physx::utils {
+    /**
+     * @brief @c TrajectoryRecorder constructor. Creates the file and starts the writer thread.
+     * @param thePath
+     *          The path of the trajectory file.
+     * @param quantum
+     *          The resolution positions are stored at.
+     * @param theKeyframeInterval
+     *          The number of frames between key frames. Seeking decodes at most this many frames.
+     * @param ringCapacity
+     *          The number of frames that can wait for the writer before frames are dropped.
+     * @throws except::TrajectoryException
+     *          If the quantum is not positive or the file cannot be created.
+     */
+    TrajectoryRecorder::TrajectoryRecorder(const std::string& thePath, math::f32 quantum,
+                                           std::size_t theKeyframeInterval, std::size_t ringCapacity)
+        : path{thePath},
+          file{thePath, std::ios::binary | std::ios::trunc},
+          inverseQuantum{1.f / quantum},
+          keyframeInterval{std::max<std::size_t>(theKeyframeInterval, 1)},
+          ring{ringCapacity} {
+        if (!(quantum > 0.f)) {
+            throw except::TrajectoryException("The trajectory quantum must be positive.");
+        }
+        if (!file) {
+            throw except::TrajectoryException("Cannot create trajectory file " + path + ".");
+        }
+
+        std::uint32_t quantumBits;
+        std::memcpy(&quantumBits, &quantum, sizeof(quantumBits));
+
+        buffer.insert(buffer.end(), std::begin(trajectory::fileMagic), std::end(trajectory::fileMagic));
+        trajectory::writeLittleEndian(buffer, trajectory::version);
+        trajectory::writeLittleEndian(buffer, static_cast<std::uint32_t>(keyframeInterval));
+        trajectory::writeLittleEndian(buffer, quantumBits);
+        trajectory::writeLittleEndian(buffer, std::uint32_t{0});
+        flush();
+
+        writer = std::thread{&TrajectoryRecorder::writerLoop, this};
+    }
+
+    /**
+     * @brief @c TrajectoryRecorder destructor. Closes the recording if @c close was not called.
+     */
+    TrajectoryRecorder::~TrajectoryRecorder() {
+        try {
+            close();
+        } catch (const std::exception& e) {
+            LLOG_ERROR("{}", e.what())
+        }
+    }
+
+    /**
+     * @brief Queues the positions of every body for one step. Never blocks.
+     *
+     * Must always be called from the same thread.
+     * @param x
+     *          The x-components of the positions.
+     * @param y
+     *          The y-components of the positions.
+     * @param count
+     *          The number of bodies.
+     * @return @c false if the writer was too far behind and the step was dropped.
+     */
+    bool TrajectoryRecorder::record(const math::f32* x, const math::f32* y, std::size_t count) {
+        const std::uint64_t step{stepCount++};
+
+        Frame* frame{closed ? nullptr : ring.acquire()};
+        if (frame == nullptr) {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        frame->step = step;
+        frame->x.assign(x, x + count);
+        frame->y.assign(y, y + count);
+        ring.publish();
+        return true;
+    }
+
+    /**
+     * @brief Writes the queued frames and the index, then closes the file. Does nothing if already closed.
+     * @throws except::TrajectoryException
+     *          If writing the file failed.
+     */
+    void TrajectoryRecorder::close() {
+        if (closed) {
+            return;
+        }
+        closed = true;
+
+        stopping.store(true, std::memory_order_release);
+        writer.join();
+        file.close();
+
+        if (droppedCount > 0) {
+            LLOG_INFO("Trajectory {} dropped {} of {} steps.", path, droppedCount.load(), stepCount)
+        }
+        if (file.fail()) {
+            throw except::TrajectoryException("Cannot write trajectory file " + path + ".");
+        }
+    }
+
+    /**
+     * @brief Gets the number of steps passed to @c record, including dropped ones.
+     * @return The number of steps.
+     */
+    std::uint64_t TrajectoryRecorder::getStepCount() const {
+        return stepCount;
+    }
+
+    /**
+     * @brief Gets the number of steps dropped because the ring was full.
+     * @return The number of dropped steps.
+     */
+    std::uint64_t TrajectoryRecorder::getDroppedCount() const {
+        return droppedCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Writes frames as they are queued until the recorder is closed and the ring is empty.
+     */
+    void TrajectoryRecorder::writerLoop() {
+        while (true) {
+            if (const Frame* frame{ring.peek()}) {
+                writeFrame(*frame);
+                ring.release();
+            } else if (stopping.load(std::memory_order_acquire)) {
+                // Frames queued before stopping was set are visible now.
+                if (ring.peek() == nullptr) {
+                    break;
+                }
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            }
+        }
+
+        writeIndex();
+    }
+
+    /**
+     * @brief Quantizes a frame and writes it as a key frame or as deltas from the previous frame.
+     * @param frame
+     *          The frame.
+     */
+    void TrajectoryRecorder::writeFrame(const Frame& frame) {
+        const bool keyframe{frameCount % keyframeInterval == 0};
+        const std::size_t count{frame.x.size()};
+
+        if (keyframe) {
+            keyframeOffsets.push_back(offset);
+            previousX.assign(count, 0);
+            previousY.assign(count, 0);
+        } else {
+            previousX.resize(count, 0);
+            previousY.resize(count, 0);
+        }
+
+        buffer.push_back(static_cast<std::uint8_t>(keyframe ? trajectory::Chunk::KeyFrame
+                                                            : trajectory::Chunk::DeltaFrame));
+        trajectory::writeVarint(buffer, frame.step);
+        trajectory::writeVarint(buffer, count);
+
+        for (std::size_t i{0}; i < count; ++i) {
+            const std::int32_t quantized{trajectory::quantize(frame.x[i], inverseQuantum)};
+            trajectory::writeVarint(buffer, trajectory::zigzag(std::int64_t{quantized} - previousX[i]));
+            previousX[i] = quantized;
+        }
+        for (std::size_t i{0}; i < count; ++i) {
+            const std::int32_t quantized{trajectory::quantize(frame.y[i], inverseQuantum)};
+            trajectory::writeVarint(buffer, trajectory::zigzag(std::int64_t{quantized} - previousY[i]));
+            previousY[i] = quantized;
+        }
+
+        flush();
+        ++frameCount;
+    }
+
+    /**
+     * @brief Writes the key frame index and the trailer that points to it.
+     */
+    void TrajectoryRecorder::writeIndex() {
+        const std::uint64_t indexOffset{offset};
+
+        buffer.push_back(static_cast<std::uint8_t>(trajectory::Chunk::Index));
+        trajectory::writeVarint(buffer, frameCount);
+        trajectory::writeVarint(buffer, keyframeOffsets.size());
+        for (const std::uint64_t keyframeOffset : keyframeOffsets) {
+            trajectory::writeLittleEndian(buffer, keyframeOffset);
+        }
+
+        trajectory::writeLittleEndian(buffer, indexOffset);
+        buffer.insert(buffer.end(), std::begin(trajectory::indexMagic), std::end(trajectory::indexMagic));
+        flush();
+    }
+
+    /**
+     * @brief Writes the encoded bytes to the file.
+     */
+    void TrajectoryRecorder::flush() {
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        offset += buffer.size();
+        buffer.clear();
+    }
+} // namespace physx::utils
@@ -0,0 +1,267 @@
+/**
+ * @file Vec2Batch.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include "../../include/physx/utilities/Vec2Batch.hpp"
+
+#include "../../include/physx/utilities/Lanes.hpp"
+
+namespace physx::utils::batch {
+    namespace {
+        template<typename Integrator, typename L>
+        std::size_t integrateLanes(math::f32* x, math::f32* y, math::f32* oldX, math::f32* oldY, math::f32* velX,
+                                   math::f32* velY, math::f32* accX, math::f32* accY, const std::uint8_t* groups,
+                                   std::size_t i, std::size_t count, math::f32 dt) {
+            const std::uint8_t group{dynamic::integrationGroup(Integrator::type)};
+            const auto step{L::set(dt)};
+            const auto zero{L::set(0.f)};
+
+            for (; i + L::width <= count; i += L::width) {
+                const auto mask{L::hasBits(groups + i, group)};
+                const auto px{L::load(x + i)};
+                const auto py{L::load(y + i)};
+                const auto ox{L::load(oldX + i)};
+                const auto oy{L::load(oldY + i)};
+                const auto vx{L::load(velX + i)};
+                const auto vy{L::load(velY + i)};
+                const auto ax{L::load(accX + i)};
+                const auto ay{L::load(accY + i)};
+
+                auto nx{px}, nox{ox}, nvx{vx};
+                auto ny{py}, noy{oy}, nvy{vy};
+                Integrator::template step<L>(nx, nox, nvx, ax, step);
+                Integrator::template step<L>(ny, noy, nvy, ay, step);
+
+                L::store(x + i, L::select(mask, nx, px));
+                L::store(y + i, L::select(mask, ny, py));
+                L::store(oldX + i, L::select(mask, nox, ox));
+                L::store(oldY + i, L::select(mask, noy, oy));
+                L::store(velX + i, L::select(mask, nvx, vx));
+                L::store(velY + i, L::select(mask, nvy, vy));
+                L::store(accX + i, L::select(mask, zero, ax));
+                L::store(accY + i, L::select(mask, zero, ay));
+            }
+            return i;
+        }
+
+        template<typename L>
+        std::size_t accelerateLanes(math::f32* accX, math::f32* accY, const std::uint8_t* enabled, std::size_t i,
+                                    std::size_t count, math::f32 ax, math::f32 ay) {
+            const auto addX{L::set(ax)};
+            const auto addY{L::set(ay)};
+
+            for (; i + L::width <= count; i += L::width) {
+                const auto mask{L::hasBits(enabled + i, 0xFF)};
+                const auto vx{L::load(accX + i)};
+                const auto vy{L::load(accY + i)};
+                L::store(accX + i, L::select(mask, L::add(vx, addX), vx));
+                L::store(accY + i, L::select(mask, L::add(vy, addY), vy));
+            }
+            return i;
+        }
+
+        template<typename L>
+        std::size_t constrainToCircleLanes(math::f32* x, math::f32* y, const math::f32* extent, std::size_t i,
+                                           std::size_t count, math::f32 centerX, math::f32 centerY,
+                                           math::f32 radius) {
+            const auto cx{L::set(centerX)};
+            const auto cy{L::set(centerY)};
+            const auto r{L::set(radius)};
+
+            for (; i + L::width <= count; i += L::width) {
+                const auto px{L::load(x + i)};
+                const auto py{L::load(y + i)};
+                const auto vx{L::sub(cx, px)};
+                const auto vy{L::sub(cy, py)};
+                const auto distance{L::sqrt(L::add(L::mul(vx, vx), L::mul(vy, vy)))};
+                const auto limit{L::sub(r, L::load(extent + i))};
+                const auto outside{L::greater(distance, limit)};
+
+                L::store(x + i, L::select(outside, L::sub(cx, L::mul(L::div(vx, distance), limit)), px));
+                L::store(y + i, L::select(outside, L::sub(cy, L::mul(L::div(vy, distance), limit)), py));
+            }
+            return i;
+        }
+
+        template<typename L>
+        std::size_t lengthLanes(const math::f32* x, const math::f32* y, math::f32* out, std::size_t i,
+                                std::size_t count) {
+            for (; i + L::width <= count; i += L::width) {
+                const auto vx{L::load(x + i)};
+                const auto vy{L::load(y + i)};
+                L::store(out + i, L::sqrt(L::add(L::mul(vx, vx), L::mul(vy, vy))));
+            }
+            return i;
+        }
+
+        template<typename L>
+        std::size_t distanceLanes(const math::f32* ax, const math::f32* ay, const math::f32* bx,
+                                  const math::f32* by, math::f32* out, std::size_t i, std::size_t count) {
+            for (; i + L::width <= count; i += L::width) {
+                const auto dx{L::sub(L::load(ax + i), L::load(bx + i))};
+                const auto dy{L::sub(L::load(ay + i), L::load(by + i))};
+                L::store(out + i, L::sqrt(L::add(L::mul(dx, dx), L::mul(dy, dy))));
+            }
+            return i;
+        }
+    } // namespace
+
+    /**
+     * @brief Gets the instruction set the batch kernels were built for.
+     * @return @c "AVX2", @c "SSE2" or @c "scalar".
+     */
+    const char* getInstructionSet() {
+#if defined(PHYSX_BATCH_AVX2)
+        return "AVX2";
+#elif defined(PHYSX_BATCH_SSE2)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+
+    /**
+     * @brief Advances every body in one integration group by one step and clears its acceleration.
+     *
+     * Bodies outside the group are left untouched, so running each non-empty group once integrates every body.
+     * @tparam Integrator
+     *          The integration policy, see @c Integrators.hpp.
+     * @param x
+     *          The x-components of the positions.
+     * @param y
+     *          The y-components of the positions.
+     * @param oldX
+     *          The x-components of the previous positions.
+     * @param oldY
+     *          The y-components of the previous positions.
+     * @param velX
+     *          The x-components of the step velocities.
+     * @param velY
+     *          The y-components of the step velocities.
+     * @param accX
+     *          The x-components of the accelerations.
+     * @param accY
+     *          The y-components of the accelerations.
+     * @param groups
+     *          The integration group bits of each body, see @c dynamic::integrationGroup.
+     * @param count
+     *          The number of bodies.
+     * @param dt
+     *          The time step.
+     */
+    template<typename Integrator>
+    void integrate(math::f32* x, math::f32* y, math::f32* oldX, math::f32* oldY, math::f32* velX, math::f32* velY,
+                   math::f32* accX, math::f32* accY, const std::uint8_t* groups, std::size_t count, math::f32 dt) {
+        std::size_t i{0};
+#if defined(PHYSX_BATCH_AVX2) || defined(PHYSX_BATCH_SSE2)
+        i = integrateLanes<Integrator, SimdLanes>(x, y, oldX, oldY, velX, velY, accX, accY, groups, i, count, dt);
+#endif
+        integrateLanes<Integrator, ScalarLanes>(x, y, oldX, oldY, velX, velY, accX, accY, groups, i, count, dt);
+    }
+
+    template void integrate<dynamic::EulerIntegrator>(math::f32*, math::f32*, math::f32*, math::f32*, math::f32*,
+                                                      math::f32*, math::f32*, math::f32*, const std::uint8_t*,
+                                                      std::size_t, math::f32);
+    template void integrate<dynamic::VerletIntegrator>(math::f32*, math::f32*, math::f32*, math::f32*, math::f32*,
+                                                       math::f32*, math::f32*, math::f32*, const std::uint8_t*,
+                                                       std::size_t, math::f32);
+    template void integrate<dynamic::RK4Integrator>(math::f32*, math::f32*, math::f32*, math::f32*, math::f32*,
+                                                    math::f32*, math::f32*, math::f32*, const std::uint8_t*,
+                                                    std::size_t, math::f32);
+
+    /**
+     * @brief Adds an acceleration to every enabled body.
+     * @param accX
+     *          The x-components of the accelerations.
+     * @param accY
+     *          The y-components of the accelerations.
+     * @param enabled
+     *          Non-zero for bodies to accelerate.
+     * @param count
+     *          The number of bodies.
+     * @param ax
+     *          The x-component of the acceleration to add.
+     * @param ay
+     *          The y-component of the acceleration to add.
+     */
+    void accelerate(math::f32* accX, math::f32* accY, const std::uint8_t* enabled, std::size_t count,
+                    math::f32 ax, math::f32 ay) {
+        std::size_t i{0};
+#if defined(PHYSX_BATCH_AVX2) || defined(PHYSX_BATCH_SSE2)
+        i = accelerateLanes<SimdLanes>(accX, accY, enabled, i, count, ax, ay);
+#endif
+        accelerateLanes<ScalarLanes>(accX, accY, enabled, i, count, ax, ay);
+    }
+
+    /**
+     * @brief Projects every body back inside a circle, keeping its extent between its center and the edge.
+     * @param x
+     *          The x-components of the positions.
+     * @param y
+     *          The y-components of the positions.
+     * @param extent
+     *          The distance each body keeps from the edge.
+     * @param count
+     *          The number of bodies.
+     * @param centerX
+     *          The x-component of the circle center.
+     * @param centerY
+     *          The y-component of the circle center.
+     * @param radius
+     *          The radius of the circle.
+     */
+    void constrainToCircle(math::f32* x, math::f32* y, const math::f32* extent, std::size_t count,
+                           math::f32 centerX, math::f32 centerY, math::f32 radius) {
+        std::size_t i{0};
+#if defined(PHYSX_BATCH_AVX2) || defined(PHYSX_BATCH_SSE2)
+        i = constrainToCircleLanes<SimdLanes>(x, y, extent, i, count, centerX, centerY, radius);
+#endif
+        constrainToCircleLanes<ScalarLanes>(x, y, extent, i, count, centerX, centerY, radius);
+    }
+
+    /**
+     * @brief Calculates the length of every vector.
+     * @param x
+     *          The x-components.
+     * @param y
+     *          The y-components.
+     * @param out
+     *          Receives the lengths.
+     * @param count
+     *          The number of vectors.
+     */
+    void length(const math::f32* x, const math::f32* y, math::f32* out, std::size_t count) {
+        std::size_t i{0};
+#if defined(PHYSX_BATCH_AVX2) || defined(PHYSX_BATCH_SSE2)
+        i = lengthLanes<SimdLanes>(x, y, out, i, count);
+#endif
+        lengthLanes<ScalarLanes>(x, y, out, i, count);
+    }
+
+    /**
+     * @brief Calculates the distance between each pair of points.
+     * @param ax
+     *          The x-components of the first points.
+     * @param ay
+     *          The y-components of the first points.
+     * @param bx
+     *          The x-components of the second points.
+     * @param by
+     *          The y-components of the second points.
+     * @param out
+     *          Receives the distances.
+     * @param count
+     *          The number of pairs.
+     */
+    void distance(const math::f32* ax, const math::f32* ay, const math::f32* bx, const math::f32* by,
+                  math::f32* out, std::size_t count) {
+        std::size_t i{0};
+#if defined(PHYSX_BATCH_AVX2) || defined(PHYSX_BATCH_SSE2)
+        i = distanceLanes<SimdLanes>(ax, ay, bx, by, out, i, count);
+#endif
+        distanceLanes<ScalarLanes>(ax, ay, bx, by, out, i, count);
+    }
+} // namespace physx::utils::batch
@@ -17,7 +17,7 @@ namespace physx::utils {
      * @return The dot product.
      */
     math::f32 dot(const math::Vec2f& a, const math::Vec2f& b) {
-        return (a.getX() * b.getX()) + (a.getY() + b.getY());
+        return (a.getX() * b.getX()) + (a.getY() * b.getY());
     }
 
     /**
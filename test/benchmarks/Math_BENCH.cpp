@@ -0,0 +1,108 @@
+/**
+ * @file Math_BENCH.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "../../include/physx/dynamic/RigidBody2D.hpp"
+#include "../../include/physx/math/Matrix2.hpp"
+#include "../../include/physx/math/Vec3.hpp"
+#include "../../include/physx/utilities/Vec2Utils.hpp"
+
+namespace {
+    using namespace physx;
+
+    /**
+     * @brief @c Vec2 addition, scaling and division.
+     */
+    void BM_Vec2Operators(benchmark::State& state) {
+        math::Vec2f a{1.5f, 2.5f};
+        math::Vec2f b{0.5f, -1.5f};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(a);
+            benchmark::DoNotOptimize(b);
+            math::Vec2f c{(a + b) * 0.5f - b / 3.f};
+            c += a;
+            benchmark::DoNotOptimize(c);
+        }
+    }
+    BENCHMARK(BM_Vec2Operators);
+
+    /**
+     * @brief @c Vec3 addition, scaling and division.
+     */
+    void BM_Vec3Operators(benchmark::State& state) {
+        math::Vec3f a{1.5f, 2.5f, 3.5f};
+        math::Vec3f b{0.5f, -1.5f, 2.f};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(a);
+            benchmark::DoNotOptimize(b);
+            math::Vec3f c{(a + b) * 0.5f - b / 3.f};
+            c += a;
+            benchmark::DoNotOptimize(c);
+        }
+    }
+    BENCHMARK(BM_Vec3Operators);
+
+    /**
+     * @brief @c Matrix2 products, transpose and inverse.
+     */
+    void BM_Matrix2Operators(benchmark::State& state) {
+        math::Matrix2 m{2.f, 1.f, 1.f, 3.f};
+        math::Vec2f v{1.f, 2.f};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(m);
+            benchmark::DoNotOptimize(v);
+            math::Matrix2 product{m * m.transpose()};
+            benchmark::DoNotOptimize(product * v);
+            benchmark::DoNotOptimize(m.inverse());
+        }
+    }
+    BENCHMARK(BM_Matrix2Operators);
+
+    /**
+     * @brief @c Vec2Utils dot, length, distance and normalize.
+     */
+    void BM_Vec2Utils(benchmark::State& state) {
+        math::Vec2f a{3.f, 4.f};
+        math::Vec2f b{-1.f, 2.f};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(a);
+            benchmark::DoNotOptimize(b);
+            benchmark::DoNotOptimize(utils::dot(a, b));
+            benchmark::DoNotOptimize(utils::length(a));
+            benchmark::DoNotOptimize(utils::distance(a, b));
+            benchmark::DoNotOptimize(utils::normalize(a));
+        }
+    }
+    BENCHMARK(BM_Vec2Utils);
+
+    /**
+     * @brief @c RigidBody2D::updatePosition for one integration method.
+     * @param state
+     *          @c range(0) is the @c IntegrationType.
+     */
+    void BM_RigidBody2DUpdatePosition(benchmark::State& state) {
+        dynamic::RigidBody2D rb{math::Vec2f{500.f, 500.f}};
+        rb.setIntegrationMethod(static_cast<dynamic::IntegrationType>(state.range(0)));
+        const math::Vec2f gravity{0.f, 1000.f};
+
+        for (auto _ : state) {
+            rb.accelerate(gravity);
+            rb.updatePosition(1.f / 60.f);
+            benchmark::DoNotOptimize(rb.getPosition());
+        }
+    }
+    BENCHMARK(BM_RigidBody2DUpdatePosition)
+        ->ArgName("integrator")
+        ->Arg(static_cast<int>(dynamic::IntegrationType::Euler))
+        ->Arg(static_cast<int>(dynamic::IntegrationType::Verlet))
+        ->Arg(static_cast<int>(dynamic::IntegrationType::RK4));
+} // namespace
@@ -0,0 +1,108 @@
+/**
+ * @file ShapeDispatch_BENCH.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+
+#include "../../include/physx/dynamic/BodyStore.hpp"
+
+namespace {
+    using namespace physx;
+
+    constexpr std::size_t bodyCount{10000};
+
+    /**
+     * @brief The heap-allocated, virtual object layout bodies had before the @c BodyStore.
+     */
+    struct LegacyObject {
+        explicit LegacyObject(const math::Vec2f& position) : position{position} {}
+        virtual ~LegacyObject() = default;
+        math::Vec2f position;
+    };
+
+    struct LegacyCircle : LegacyObject {
+        LegacyCircle(const math::Vec2f& position, math::f32 radius) : LegacyObject{position}, radius{radius} {}
+        math::f32 radius;
+    };
+
+    struct LegacyRectangle : LegacyObject {
+        LegacyRectangle(const math::Vec2f& position, math::f32 width) : LegacyObject{position}, width{width} {}
+        math::f32 width;
+    };
+
+    /**
+     * @brief The boundary test, finding each body's extent with @c dynamic_cast as @c applyConstraints used to.
+     */
+    void BM_ShapeDispatchDynamicCast(benchmark::State& state) {
+        std::vector<std::unique_ptr<LegacyObject>> objects;
+        for (std::size_t i{0}; i < bodyCount; ++i) {
+            const math::Vec2f position{static_cast<math::f32>(i % 100) * 9.f, static_cast<math::f32>(i / 100) * 9.f};
+            if (i % 8 == 0) {
+                objects.emplace_back(std::make_unique<LegacyRectangle>(position, 4.f));
+            } else {
+                objects.emplace_back(std::make_unique<LegacyCircle>(position, 3.f));
+            }
+        }
+
+        for (auto _ : state) {
+            std::size_t outside{0};
+            for (const auto& obj : objects) {
+                math::f32 extent;
+                if (auto* circle{dynamic_cast<LegacyCircle*>(obj.get())}) {
+                    extent = circle->radius;
+                } else {
+                    extent = dynamic_cast<LegacyRectangle*>(obj.get())->width;
+                }
+
+                const math::f32 dx{500.f - obj->position.getX()};
+                const math::f32 dy{500.f - obj->position.getY()};
+                outside += std::sqrt(dx * dx + dy * dy) > 450.f - extent ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(outside);
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(bodyCount));
+    }
+    BENCHMARK(BM_ShapeDispatchDynamicCast);
+
+    /**
+     * @brief The same boundary test, branching on the @c ShapeType tag of a @c BodyStore.
+     */
+    void BM_ShapeDispatchTag(benchmark::State& state) {
+        dynamic::BodyStore bodies;
+        for (std::size_t i{0}; i < bodyCount; ++i) {
+            const math::Vec2f position{static_cast<math::f32>(i % 100) * 9.f, static_cast<math::f32>(i / 100) * 9.f};
+            if (i % 8 == 0) {
+                bodies.add(dynamic::ShapeType::Rectangle, position, 0.f, 4.f, 4.f, 500.f, true);
+            } else {
+                bodies.add(dynamic::ShapeType::Circle, position, 3.f, 0.f, 0.f, 500.f, true);
+            }
+        }
+
+        const dynamic::ShapeType* shape{bodies.getShape()};
+        const math::f32* px{bodies.getPositionX()};
+        const math::f32* py{bodies.getPositionY()};
+        const math::f32* radius{bodies.getRadius()};
+        const math::f32* width{bodies.getWidth()};
+
+        for (auto _ : state) {
+            std::size_t outside{0};
+            for (std::size_t i{0}; i < bodyCount; ++i) {
+                const math::f32 extent{shape[i] == dynamic::ShapeType::Circle ? radius[i] : width[i]};
+                const math::f32 dx{500.f - px[i]};
+                const math::f32 dy{500.f - py[i]};
+                outside += std::sqrt(dx * dx + dy * dy) > 450.f - extent ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(outside);
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(bodyCount));
+    }
+    BENCHMARK(BM_ShapeDispatchTag);
+} // namespace
@@ -0,0 +1,157 @@
+/**
+ * @file Simulation_BENCH.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+#include "../../include/physx/core/SceneLoader.hpp"
+
+namespace {
+    using namespace physx;
+
+    /**
+     * @brief Fills a @c Simulation with circles sized so that @p count of them fit the boundary.
+     * @param simulation
+     *          The @c Simulation to fill.
+     * @param count
+     *          The number of circles.
+     */
+    void fillSimulation(core::Simulation& simulation, std::size_t count) {
+        const math::f32 area{3.14159265f * simulation.getConstraintRadius() * simulation.getConstraintRadius()};
+        const math::f32 radius{std::sqrt(area / (1.25f * static_cast<math::f32>(count))) / 2.1f};
+
+        std::istringstream scene{"fill " + std::to_string(count) + " " + std::to_string(radius)};
+        core::SceneLoader::load(scene, simulation);
+    }
+
+    /**
+     * @brief A whole @c Simulation::update step.
+     * @param state
+     *          @c range(0) is the number of bodies and @c range(1) the @c collision::BroadphaseType.
+     */
+    void BM_SimulationUpdate(benchmark::State& state) {
+        const auto bodies{static_cast<std::size_t>(state.range(0))};
+
+        core::Simulation simulation;
+        simulation.setBroadphase(static_cast<collision::BroadphaseType>(state.range(1)));
+        fillSimulation(simulation, bodies);
+
+        for (auto _ : state) {
+            simulation.update(1.f / 60.f);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.counters["ns_per_body_step"] = benchmark::Counter(
+                static_cast<double>(bodies) * 1e-9,
+                benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    }
+    BENCHMARK(BM_SimulationUpdate)
+        ->ArgNames({"bodies", "broadphase"})
+        ->ArgsProduct({{1000, 10000, 100000}, {0, 1, 2}})
+        ->Unit(benchmark::kMillisecond);
+
+    /**
+     * @brief A @c Simulation::update step with small debris mixed with a few large boulders, which forces the
+     * uniform grid to use cells sized for the boulders.
+     * @param state
+     *          @c range(0) is the number of debris circles and @c range(1) the @c collision::BroadphaseType.
+     */
+    void BM_SimulationUpdateMixedSizes(benchmark::State& state) {
+        const auto bodies{static_cast<std::size_t>(state.range(0))};
+
+        core::Simulation simulation;
+        simulation.setBroadphase(static_cast<collision::BroadphaseType>(state.range(1)));
+        fillSimulation(simulation, bodies);
+        for (math::i32 i{0}; i < 8; ++i) {
+            simulation.addCircleObject(60.f, {200.f + 85.f * static_cast<math::f32>(i), 300.f}, false);
+        }
+
+        for (auto _ : state) {
+            simulation.update(1.f / 60.f);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.counters["ns_per_body_step"] = benchmark::Counter(
+                static_cast<double>(bodies) * 1e-9,
+                benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    }
+    BENCHMARK(BM_SimulationUpdateMixedSizes)
+        ->ArgNames({"bodies", "broadphase"})
+        ->ArgsProduct({{10000}, {0, 1, 2}})
+        ->Unit(benchmark::kMillisecond);
+
+    /**
+     * @brief A @c Simulation::update step with rows of pinned ropes, which exercises the joint solve.
+     * @param state
+     *          @c range(0) is the total number of links, in ropes of 50, and @c range(1) the thread count.
+     */
+    void BM_SimulationUpdateRopes(benchmark::State& state) {
+        const auto links{static_cast<std::size_t>(state.range(0))};
+        const std::size_t ropes{links / 50};
+        const std::size_t rows{(ropes + 3) / 4};
+
+        core::Simulation simulation;
+        simulation.setThreadCount(static_cast<std::size_t>(state.range(1)));
+        std::ostringstream scene;
+        for (std::size_t i{0}; i < ropes; ++i) {
+            scene << "rope 50 1 " << 300.f + 102.f * static_cast<math::f32>(i % 4) << ' '
+                  << 200.f + 600.f * static_cast<math::f32>(i / 4) / static_cast<math::f32>(rows) << '\n';
+        }
+        std::istringstream input{scene.str()};
+        core::SceneLoader::load(input, simulation);
+
+        for (auto _ : state) {
+            simulation.update(1.f / 60.f);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_SimulationUpdateRopes)
+        ->ArgNames({"links", "threads"})
+        ->ArgsProduct({{20000}, {1, 4}})
+        ->Unit(benchmark::kMillisecond);
+
+    /**
+     * @brief A @c Simulation::update step with the circular boundary traced by a closed polyline, which checks
+     * that the cost per body stays flat as the level gets more detailed.
+     * @param state
+     *          @c range(0) is the number of segments in the polyline, zero for the boundary alone.
+     */
+    void BM_SimulationUpdateColliders(benchmark::State& state) {
+        const auto segments{static_cast<std::size_t>(state.range(0))};
+        const std::size_t bodies{10000};
+
+        core::Simulation simulation;
+        fillSimulation(simulation, bodies);
+        const math::Vec2f& center{simulation.getConstraintCenter()};
+        std::vector<math::Vec2f> points;
+        for (std::size_t i{0}; i < segments; ++i) {
+            const math::f32 angle{6.2831853f * static_cast<math::f32>(i) / static_cast<math::f32>(segments)};
+            points.push_back(center + math::Vec2f{std::cos(angle), std::sin(angle)} *
+                                      simulation.getConstraintRadius());
+        }
+        simulation.getColliders().addPolyline(points, true);
+
+        for (auto _ : state) {
+            simulation.update(1.f / 60.f);
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(bodies));
+        state.counters["ns_per_body_step"] = benchmark::Counter(
+                static_cast<double>(bodies) * 1e-9,
+                benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    }
+    BENCHMARK(BM_SimulationUpdateColliders)
+        ->ArgNames({"segments"})
+        ->Args({0})
+        ->Args({64})
+        ->Args({4096})
+        ->Unit(benchmark::kMillisecond);
+} // namespace
@@ -0,0 +1,79 @@
+/**
+ * @file Vec2Batch_BENCH.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "../../include/physx/utilities/Vec2Batch.hpp"
+#include "../../include/physx/utilities/Vec2Utils.hpp"
+
+namespace {
+    using namespace physx;
+
+    /**
+     * @brief Array-of-vectors @c Vec2Utils::distance, the shape of the code before the batch kernels.
+     */
+    void BM_DistanceScalar(benchmark::State& state) {
+        const auto count{static_cast<std::size_t>(state.range(0))};
+        std::vector<math::Vec2f> a(count, {1.f, 2.f});
+        std::vector<math::Vec2f> b(count, {4.f, 6.f});
+        std::vector<math::f32> out(count);
+
+        for (auto _ : state) {
+            for (std::size_t i{0}; i < count; ++i) {
+                out[i] = utils::distance(a[i], b[i]);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+    BENCHMARK(BM_DistanceScalar)->Arg(1 << 10)->Arg(1 << 16);
+
+    /**
+     * @brief @c batch::distance over separate x and y arrays.
+     */
+    void BM_DistanceBatch(benchmark::State& state) {
+        const auto count{static_cast<std::size_t>(state.range(0))};
+        std::vector<math::f32> ax(count, 1.f), ay(count, 2.f), bx(count, 4.f), by(count, 6.f), out(count);
+
+        for (auto _ : state) {
+            utils::batch::distance(ax.data(), ay.data(), bx.data(), by.data(), out.data(), count);
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+        state.SetLabel(utils::batch::getInstructionSet());
+    }
+    BENCHMARK(BM_DistanceBatch)->Arg(1 << 10)->Arg(1 << 16);
+
+    /**
+     * @brief @c batch::integrate for one integration policy with every body in its group.
+     * @tparam Integrator
+     *          The integration policy.
+     */
+    template<typename Integrator>
+    void BM_IntegrateBatch(benchmark::State& state) {
+        const auto count{static_cast<std::size_t>(state.range(0))};
+        std::vector<math::f32> x(count, 1.f), y(count, 2.f), oldX(count, 1.f), oldY(count, 2.f);
+        std::vector<math::f32> velX(count), velY(count), accX(count), accY(count);
+        std::vector<std::uint8_t> groups(count, dynamic::integrationGroup(Integrator::type));
+
+        for (auto _ : state) {
+            utils::batch::integrate<Integrator>(x.data(), y.data(), oldX.data(), oldY.data(), velX.data(),
+                                                velY.data(), accX.data(), accY.data(), groups.data(), count,
+                                                1.f / 60.f);
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+        state.SetLabel(utils::batch::getInstructionSet());
+    }
+    BENCHMARK_TEMPLATE(BM_IntegrateBatch, dynamic::EulerIntegrator)->Arg(1 << 10)->Arg(1 << 16);
+    BENCHMARK_TEMPLATE(BM_IntegrateBatch, dynamic::VerletIntegrator)->Arg(1 << 10)->Arg(1 << 16);
+    BENCHMARK_TEMPLATE(BM_IntegrateBatch, dynamic::RK4Integrator)->Arg(1 << 10)->Arg(1 << 16);
+} // namespace
@@ -0,0 +1,39 @@
+/**
+ * @file main.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <vector>
+
+/**
+ * @brief Runs every registered benchmark, reporting JSON unless another format is requested.
+ *
+ * Each @c Simulation benchmark reports an @c ns_per_body_step counter so runs can be compared across commits.
+ */
+int main(int argc, char** argv) {
+    static char jsonFormat[]{"--benchmark_format=json"};
+
+    std::vector<char*> args{argv, argv + argc};
+    bool formatGiven{false};
+    for (int i{1}; i < argc; ++i) {
+        formatGiven = formatGiven || std::strncmp(argv[i], "--benchmark_format", 18) == 0;
+    }
+    if (!formatGiven) {
+        args.push_back(jsonFormat);
+    }
+
+    int count{static_cast<int>(args.size())};
+    benchmark::Initialize(&count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(count, args.data())) {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
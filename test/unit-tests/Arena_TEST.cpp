@@ -0,0 +1,27 @@
+/**
+ * @file Arena_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../../include/physx/utilities/Arena.hpp"
+
+/**
+ * @brief @c Arena test 1.
+ */
+TEST(Arena, GIVEN_resetArena_WHEN_allocatedAgain_THEN_slabsAreReused) {
+    physx::utils::Arena arena{4096};
+    void* first{arena.allocate(1000, 64)};
+    arena.allocate(5000, 64);
+    ASSERT_EQ(2u, arena.getSlabCount());
+
+    arena.reset();
+    ASSERT_EQ(first, arena.allocate(1000, 64));
+    ASSERT_EQ(2u, arena.getSlabCount());
+
+    arena.release();
+    ASSERT_EQ(0u, arena.getSlabCount());
+}
@@ -0,0 +1,169 @@
+/**
+ * @file BodyStore_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+#include "../../include/physx/dynamic/BodyStore.hpp"
+
+/**
+ * @brief @c BodyStore test 1.
+ */
+TEST(BodyStore, GIVEN_manyBodies_WHEN_storeGrows_THEN_existingBodiesAreKept) {
+    physx::dynamic::BodyStore store;
+    for (std::size_t i{0}; i < 1000; ++i) {
+        store.add(physx::dynamic::ShapeType::Circle, {static_cast<float>(i), 2.f}, 3.f, 0.f, 0.f, 500.f, true);
+    }
+
+    ASSERT_EQ(1000u, store.size());
+    ASSERT_GE(store.getCapacity(), 1000u);
+    for (std::size_t i{0}; i < 1000; ++i) {
+        ASSERT_EQ(static_cast<float>(i), store.getPositionX()[i]);
+        ASSERT_EQ(3.f, store.getExtent()[i]);
+    }
+}
+
+/**
+ * @brief @c BodyStore test 2.
+ */
+TEST(BodyStore, GIVEN_removedBody_WHEN_bodyAdded_THEN_slotIsReused) {
+    physx::dynamic::BodyStore store;
+    store.add(physx::dynamic::ShapeType::Circle, {1.f, 1.f}, 3.f, 0.f, 0.f, 500.f, true);
+    store.add(physx::dynamic::ShapeType::Circle, {2.f, 2.f}, 3.f, 0.f, 0.f, 500.f, true);
+
+    store.remove(0);
+    ASSERT_EQ(physx::dynamic::ShapeType::None, store.getShape()[0]);
+    ASSERT_EQ(0, store.getRbEnabled()[0]);
+    ASSERT_EQ(1u, store.getFreeCount());
+
+    const std::size_t index{store.add(physx::dynamic::ShapeType::Rectangle, {5.f, 6.f}, 0.f, 4.f, 2.f, 500.f, true)};
+    ASSERT_EQ(0u, index);
+    ASSERT_EQ(2u, store.size());
+    ASSERT_EQ(0u, store.getFreeCount());
+    ASSERT_EQ(physx::dynamic::ShapeType::Rectangle, store.getShape()[0]);
+    ASSERT_EQ(1.f, store.getExtent()[0]);
+    ASSERT_EQ(1u, store.getShapeCount(physx::dynamic::ShapeType::Rectangle));
+    ASSERT_EQ(1u, store.getShapeCount(physx::dynamic::ShapeType::Circle));
+}
+
+/**
+ * @brief @c BodyStore test 3.
+ */
+TEST(BodyStore, GIVEN_sleepingIsland_WHEN_oneBodyWoken_THEN_wholeIslandWakes) {
+    physx::dynamic::BodyStore store;
+    for (std::size_t i{0}; i < 4; ++i) {
+        store.add(physx::dynamic::ShapeType::Circle, {static_cast<float>(i), 2.f}, 3.f, 0.f, 0.f, 500.f, true);
+    }
+
+    store.sleep(0, 0);
+    store.sleep(1, 0);
+    store.sleep(2, 0);
+    store.sleep(3, 3);
+    ASSERT_EQ(4u, store.getSleepingCount());
+    ASSERT_EQ(0, store.getIntegrationGroups()[1]);
+
+    store.wake(1);
+    ASSERT_EQ(1u, store.getSleepingCount());
+    ASSERT_FALSE(store.isAsleep(0));
+    ASSERT_FALSE(store.isAsleep(2));
+    ASSERT_TRUE(store.isAsleep(3));
+    ASSERT_EQ(physx::dynamic::integrationGroup(physx::dynamic::IntegrationType::Verlet),
+              store.getIntegrationGroups()[0]);
+}
+
+/**
+ * @brief @c BodyStore test 4.
+ */
+TEST(BodyStore, GIVEN_savedSnapshot_WHEN_loaded_THEN_bodiesAreRestored) {
+    const std::string path{(std::filesystem::temp_directory_path() / "physx_BodyStore_TEST.snap").string()};
+    physx::dynamic::BodyStore saved;
+    for (std::size_t i{0}; i < 300; ++i) {
+        saved.add(physx::dynamic::ShapeType::Circle, {static_cast<float>(i), 2.f}, 3.f, 0.f, 0.f, 500.f, i % 3 != 0,
+                  physx::dynamic::IntegrationType::RK4);
+    }
+    saved.add(physx::dynamic::ShapeType::Rectangle, {5.f, 6.f}, 0.f, 4.f, 2.f, 250.f, true);
+    saved.getPositionOldY()[7] = 1.5f;
+    saved.remove(10);
+    saved.saveSnapshot(path);
+
+    physx::dynamic::BodyStore loaded;
+    loaded.add(physx::dynamic::ShapeType::Circle, {1.f, 1.f}, 3.f, 0.f, 0.f, 500.f, true);
+    loaded.loadSnapshot(path);
+
+    ASSERT_EQ(301u, loaded.size());
+    ASSERT_EQ(1u, loaded.getFreeCount());
+    ASSERT_EQ(199u, loaded.getIntegrationCount(physx::dynamic::IntegrationType::RK4));
+    ASSERT_EQ(1u, loaded.getIntegrationCount(physx::dynamic::IntegrationType::Verlet));
+    ASSERT_EQ(1.5f, loaded.getPositionOldY()[7]);
+    ASSERT_EQ(physx::dynamic::ShapeType::Rectangle, loaded.getShape()[300]);
+    ASSERT_EQ(250.f, loaded.getMass()[300]);
+
+    // Reuses the removed slot, then grows out of the snapshot.
+    ASSERT_EQ(10u, loaded.add(physx::dynamic::ShapeType::Circle, {0.f, 0.f}, 1.f, 0.f, 0.f, 500.f, true));
+    loaded.add(physx::dynamic::ShapeType::Circle, {0.f, 0.f}, 1.f, 0.f, 0.f, 500.f, true);
+    ASSERT_EQ(299.f, loaded.getPositionX()[299]);
+
+    std::filesystem::remove(path);
+}
+
+/**
+ * @brief @c BodyStore test 5.
+ */
+TEST(BodyStore, GIVEN_fileThatIsNotASnapshot_WHEN_loaded_THEN_throwsAndKeepsBodies) {
+    const std::string path{(std::filesystem::temp_directory_path() / "physx_BodyStore_TEST.txt").string()};
+    std::ofstream{path} << "circle 3 100 100\n";
+
+    physx::dynamic::BodyStore store;
+    store.add(physx::dynamic::ShapeType::Circle, {1.f, 1.f}, 3.f, 0.f, 0.f, 500.f, true);
+    ASSERT_THROW(store.loadSnapshot(path), physx::except::SnapshotException);
+    ASSERT_EQ(1u, store.size());
+
+    std::filesystem::remove(path);
+}
+
+/**
+ * @brief @c BodyStore test 6.
+ */
+TEST(BodyStore, GIVEN_savedRectangles_WHEN_loaded_THEN_extentIsHalfTheShorterSide) {
+    const std::string path{(std::filesystem::temp_directory_path() / "physx_BodyStore_TEST.snap").string()};
+    physx::dynamic::BodyStore saved;
+    saved.add(physx::dynamic::ShapeType::Rectangle, {5.f, 6.f}, 0.f, 4.f, 2.f, 250.f, true);
+    saved.add(physx::dynamic::ShapeType::Rectangle, {7.f, 8.f}, 0.f, 3.f, 10.f, 250.f, true);
+    saved.saveSnapshot(path);
+
+    physx::dynamic::BodyStore loaded;
+    loaded.loadSnapshot(path);
+    ASSERT_EQ(1.f, loaded.getExtent()[0]);
+    ASSERT_EQ(1.5f, loaded.getExtent()[1]);
+
+    std::filesystem::remove(path);
+}
+
+/**
+ * @brief @c BodyStore test 7.
+ */
+TEST(BodyStore, GIVEN_snapshotOfOlderVersion_WHEN_loaded_THEN_throwsAndKeepsBodies) {
+    const std::string path{(std::filesystem::temp_directory_path() / "physx_BodyStore_TEST.snap").string()};
+    physx::dynamic::BodyStore saved;
+    saved.add(physx::dynamic::ShapeType::Rectangle, {5.f, 6.f}, 0.f, 4.f, 2.f, 250.f, true);
+    saved.saveSnapshot(path);
+
+    // The version follows the eight byte magic.
+    std::fstream file{path, std::ios::in | std::ios::out | std::ios::binary};
+    const std::uint32_t version{1};
+    file.seekp(8);
+    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    file.close();
+
+    physx::dynamic::BodyStore store;
+    store.add(physx::dynamic::ShapeType::Circle, {1.f, 1.f}, 3.f, 0.f, 0.f, 500.f, true);
+    ASSERT_THROW(store.loadSnapshot(path), physx::except::SnapshotException);
+    ASSERT_EQ(1u, store.size());
+
+    std::filesystem::remove(path);
+}
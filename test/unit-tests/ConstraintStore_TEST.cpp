@@ -0,0 +1,71 @@
+/**
+ * @file ConstraintStore_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "../../include/physx/core/Simulation.hpp"
+#include "../../include/physx/dynamic/ConstraintStore.hpp"
+
+/**
+ * @brief @c ConstraintStore test 1.
+ */
+TEST(ConstraintStore, GIVEN_chainOfJoints_WHEN_colored_THEN_noColorSharesABody) {
+    physx::dynamic::ConstraintStore store;
+    for (std::uint32_t i{0}; i < 99; ++i) {
+        store.add(physx::dynamic::ConstraintType::Distance, i, i + 1, 10.f);
+    }
+    store.add(physx::dynamic::ConstraintType::Pin, 0, physx::dynamic::ConstraintStore::noBody, 0.f);
+    store.buildColors();
+
+    ASSERT_TRUE(store.hasColors());
+    ASSERT_EQ(store.size(), store.getColorEnd(store.getColorCount() - 1));
+    for (std::size_t color{0}; color < store.getColorCount(); ++color) {
+        ASSERT_TRUE(store.isColorParallel(color));
+        std::vector<bool> used(100, false);
+        for (std::size_t k{store.getColorBegin(color)}; k < store.getColorEnd(color); ++k) {
+            const std::uint32_t joint{store.getOrder()[k]};
+            for (const std::uint32_t body : {store.getBodyA()[joint], store.getBodyB()[joint]}) {
+                if (body != physx::dynamic::ConstraintStore::noBody) {
+                    ASSERT_FALSE(used[body]);
+                    used[body] = true;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief @c ConstraintStore test 2.
+ */
+TEST(ConstraintStore, GIVEN_pinnedRope_WHEN_itSwingsUnderGravity_THEN_linksStayCloseToTheirLength) {
+    physx::core::Simulation simulation;
+    simulation.setThreadCount(2);
+    simulation.setSolver(physx::collision::SolverType::GaussSeidel, 8);
+    std::vector<physx::core::object::Object2D> links;
+    for (int i{0}; i < 10; ++i) {
+        links.push_back(simulation.addCircleObject(4.f, {500.f + static_cast<float>(i) * 10.f, 300.f}, true));
+    }
+    simulation.addPin(links[0], {500.f, 300.f});
+    for (std::size_t i{1}; i < links.size(); ++i) {
+        simulation.addDistanceJoint(links[i - 1], links[i]);
+    }
+
+    for (int step{0}; step < 120; ++step) {
+        simulation.update(1.f / 60.f);
+    }
+
+    const physx::math::f32* x{simulation.getBodies().getPositionX()};
+    const physx::math::f32* y{simulation.getBodies().getPositionY()};
+    ASSERT_NEAR(500.f, x[0], 0.5f);
+    ASSERT_NEAR(300.f, y[0], 0.5f);
+    for (std::size_t i{1}; i < links.size(); ++i) {
+        ASSERT_NEAR(10.f, std::hypot(x[i] - x[i - 1], y[i] - y[i - 1]), 1.f);
+    }
+    ASSERT_GT(y[links.size() - 1], 350.f);
+}
@@ -0,0 +1,96 @@
+/**
+ * @file ContactCache_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../../include/physx/collision/ContactCache.hpp"
+
+/**
+ * @brief @c ContactCache test 1.
+ */
+TEST(ContactCache, GIVEN_storedPair_WHEN_warmStartedWithBodiesSwapped_THEN_impulsesAreReused) {
+    physx::collision::ContactCache cache;
+    std::vector<physx::collision::Contact> contacts(2);
+    contacts[0].a = 3;
+    contacts[0].b = 7;
+    contacts[0].normalY = 1.f;
+    contacts[0].normalImpulse = 4.f;
+    contacts[0].tangentImpulse = -1.f;
+    contacts[1].a = 1;
+    contacts[1].b = 2;
+    contacts[1].normalX = 1.f;
+    contacts[1].normalImpulse = 9.f;
+    cache.store(contacts);
+    ASSERT_EQ(2u, cache.size());
+
+    std::vector<physx::collision::Contact> next(2);
+    next[0].a = 7;
+    next[0].b = 3;
+    next[0].normalY = -1.f;
+    next[1].a = 5;
+    next[1].b = 6;
+    next[1].normalX = 1.f;
+    next[1].normalImpulse = 2.f;
+    cache.warmStart(next);
+
+    ASSERT_FLOAT_EQ(4.f, next[0].normalImpulse);
+    ASSERT_FLOAT_EQ(-1.f, next[0].tangentImpulse);
+    ASSERT_FLOAT_EQ(0.f, next[1].normalImpulse);
+}
+
+/**
+ * @brief @c ContactCache test 2.
+ */
+TEST(ContactCache, GIVEN_storedPair_WHEN_normalTurnedOrCleared_THEN_impulsesStartFromZero) {
+    physx::collision::ContactCache cache;
+    std::vector<physx::collision::Contact> contacts(1);
+    contacts[0].a = 0;
+    contacts[0].b = 1;
+    contacts[0].normalX = 1.f;
+    contacts[0].normalImpulse = 4.f;
+    cache.store(contacts);
+
+    contacts[0].normalX = 0.f;
+    contacts[0].normalY = 1.f;
+    cache.warmStart(contacts);
+    ASSERT_FLOAT_EQ(0.f, contacts[0].normalImpulse);
+
+    contacts[0].normalX = 1.f;
+    contacts[0].normalY = 0.f;
+    cache.clear();
+    cache.warmStart(contacts);
+    ASSERT_EQ(0u, cache.size());
+    ASSERT_FLOAT_EQ(0.f, contacts[0].normalImpulse);
+}
+
+/**
+ * @brief @c ContactCache test 3.
+ */
+TEST(ContactCache, GIVEN_storedPairs_WHEN_oneBodyRemoved_THEN_onlyItsPairsStartFromZero) {
+    physx::collision::ContactCache cache;
+    std::vector<physx::collision::Contact> contacts(2);
+    contacts[0].a = 0;
+    contacts[0].b = 1;
+    contacts[0].normalX = 1.f;
+    contacts[0].normalImpulse = 4.f;
+    contacts[1].a = 2;
+    contacts[1].b = 3;
+    contacts[1].normalX = 1.f;
+    contacts[1].normalImpulse = 6.f;
+    cache.store(contacts);
+
+    cache.removeBody(1);
+    cache.warmStart(contacts);
+    ASSERT_FLOAT_EQ(0.f, contacts[0].normalImpulse);
+    ASSERT_FLOAT_EQ(6.f, contacts[1].normalImpulse);
+
+    contacts[0].normalImpulse = 5.f;
+    cache.store(contacts);
+    cache.warmStart(contacts);
+    ASSERT_FLOAT_EQ(5.f, contacts[0].normalImpulse);
+    ASSERT_FLOAT_EQ(6.f, contacts[1].normalImpulse);
+}
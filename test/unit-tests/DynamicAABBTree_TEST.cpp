@@ -0,0 +1,98 @@
+/**
+ * @file DynamicAABBTree_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+
+#include "../../include/physx/collision/DynamicAABBTree.hpp"
+
+namespace {
+    using PairSet = std::vector<std::pair<std::uint32_t, std::uint32_t>>;
+
+    /**
+     * @brief Makes boxes of very different sizes, from small debris to large slabs.
+     */
+    std::vector<physx::collision::AABB> mixedBoxes(std::size_t count) {
+        std::mt19937 mt{7};
+        std::uniform_real_distribution<float> position{0.f, 1000.f};
+        std::uniform_real_distribution<float> debris{0.5f, 2.f};
+        std::uniform_real_distribution<float> slab{20.f, 120.f};
+
+        std::vector<physx::collision::AABB> boxes(count);
+        for (std::size_t i{0}; i < count; ++i) {
+            const float x{position(mt)};
+            const float y{position(mt)};
+            const float halfWidth{i % 50 == 0 ? slab(mt) : debris(mt)};
+            const float halfHeight{i % 50 == 0 ? slab(mt) / 4.f : debris(mt)};
+            boxes[i] = {x - halfWidth, y - halfHeight, x + halfWidth, y + halfHeight};
+        }
+        return boxes;
+    }
+} // namespace
+
+/**
+ * @brief @c DynamicAABBTree test 1.
+ */
+TEST(DynamicAABBTree, GIVEN_mixedSizeBoxes_WHEN_pairsFound_THEN_everyOverlapIsReportedOnce) {
+    const auto boxes{mixedBoxes(2000)};
+
+    physx::collision::DynamicAABBTree tree{1.f};
+    tree.update(boxes.data(), boxes.size());
+
+    std::vector<physx::collision::CollisionPair> pairs;
+    tree.findPairs(pairs);
+
+    PairSet candidates;
+    for (const auto& pair : pairs) {
+        ASSERT_LT(pair.a, pair.b);
+        candidates.emplace_back(pair.a, pair.b);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    ASSERT_TRUE(std::adjacent_find(candidates.begin(), candidates.end()) == candidates.end());
+
+    for (std::uint32_t i{0}; i < boxes.size(); ++i) {
+        for (std::uint32_t k{i + 1}; k < boxes.size(); ++k) {
+            if (boxes[i].overlaps(boxes[k])) {
+                ASSERT_TRUE(std::binary_search(candidates.begin(), candidates.end(), std::make_pair(i, k)));
+            }
+        }
+    }
+
+    ASSERT_LE(tree.getHeight(), 4 * static_cast<int>(std::log2(boxes.size())));
+}
+
+/**
+ * @brief @c DynamicAABBTree test 2.
+ */
+TEST(DynamicAABBTree, GIVEN_bodiesMoveWithinMargin_WHEN_updated_THEN_onlyEscapedLeavesAreReinserted) {
+    auto boxes{mixedBoxes(100)};
+
+    physx::collision::DynamicAABBTree tree{1.f};
+    tree.update(boxes.data(), boxes.size());
+
+    for (auto& box : boxes) {
+        box = {box.minX + 0.5f, box.minY, box.maxX + 0.5f, box.maxY};
+    }
+    tree.update(boxes.data(), boxes.size());
+    ASSERT_EQ(0u, tree.getReinsertCount());
+
+    boxes[3] = {boxes[3].minX + 10.f, boxes[3].minY, boxes[3].maxX + 10.f, boxes[3].maxY};
+    boxes[4] = physx::collision::AABB::empty();
+    tree.update(boxes.data(), boxes.size());
+    ASSERT_EQ(1u, tree.getReinsertCount());
+
+    std::vector<physx::collision::CollisionPair> pairs;
+    tree.findPairs(pairs);
+    for (const auto& pair : pairs) {
+        ASSERT_NE(4u, pair.a);
+        ASSERT_NE(4u, pair.b);
+    }
+}
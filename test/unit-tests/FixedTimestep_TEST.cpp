@@ -0,0 +1,50 @@
+/**
+ * @file FixedTimestep_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "../../include/physx/utilities/FixedTimestep.hpp"
+
+/**
+ * @brief @c FixedTimestep test 1.
+ */
+TEST(FixedTimestep, GIVEN_shortFrames_WHEN_advanced_THEN_stepsRunOnceEnoughTimeAccumulates) {
+    physx::utils::FixedTimestep timestep{100.f, 4, 5};
+
+    ASSERT_EQ(0u, timestep.advance(0.006f));
+    ASSERT_EQ(1u, timestep.advance(0.006f));
+    ASSERT_NEAR(0.2f, timestep.getAlpha(), 1e-4f);
+    ASSERT_NEAR(0.0025f, timestep.getSubStepSize(), 1e-7f);
+    ASSERT_EQ(4u, timestep.getSubSteps());
+}
+
+/**
+ * @brief @c FixedTimestep test 2.
+ */
+TEST(FixedTimestep, GIVEN_frameSpike_WHEN_advanced_THEN_stepsCappedAndBacklogDropped) {
+    physx::utils::FixedTimestep timestep{100.f, 1, 5};
+
+    ASSERT_EQ(5u, timestep.advance(1.f));
+    ASSERT_LT(timestep.getAlpha(), 1.f);
+    ASSERT_LE(timestep.advance(0.01f), 2u);
+}
+
+/**
+ * @brief @c FixedTimestep test 3.
+ */
+TEST(FixedTimestep, GIVEN_nonPositiveRate_WHEN_set_THEN_stepSizeStaysFiniteAndPositive) {
+    physx::utils::FixedTimestep timestep{0.f, 1, 5};
+    ASSERT_TRUE(std::isfinite(timestep.getStepSize()));
+    ASSERT_GT(timestep.getStepSize(), 0.f);
+
+    timestep.setRate(-60.f);
+    ASSERT_TRUE(std::isfinite(timestep.getStepSize()));
+    ASSERT_GT(timestep.getStepSize(), 0.f);
+    ASSERT_EQ(0u, timestep.advance(0.1f));
+}
@@ -0,0 +1,69 @@
+/**
+ * @file InputLog_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <sstream>
+
+#include "../../include/physx/core/InputLog.hpp"
+
+namespace {
+    void addScene(physx::core::Simulation& simulation) {
+        for (int i{0}; i < 300; ++i) {
+            simulation.addCircleObject(4.f, {300.f + static_cast<float>(i % 20) * 9.f,
+                                             300.f + static_cast<float>(i / 20) * 9.f}, true);
+        }
+    }
+
+    void run(physx::core::Simulation& simulation, physx::core::InputLog& inputLog, int steps) {
+        for (int step{0}; step < steps; ++step) {
+            inputLog.apply(simulation);
+            simulation.update(inputLog.getStepSize());
+        }
+    }
+} // namespace
+
+/**
+ * @brief @c InputLog test 1.
+ */
+TEST(InputLog, GIVEN_savedLog_WHEN_replayedOnMoreThreads_THEN_stateIsBitIdentical) {
+    physx::core::Simulation recorded;
+    addScene(recorded);
+    physx::core::InputLog recordedLog;
+    recordedLog.setSeed(42);
+    recordedLog.setStepSize(1.f / 120.f);
+
+    run(recorded, recordedLog, 20);
+    recordedLog.add({recorded.getStepCount(), physx::dynamic::ShapeType::Circle, 20.f, 0.f, {500.1f, 310.3f}, true,
+                     physx::dynamic::IntegrationType::RK4});
+    recordedLog.add({recorded.getStepCount(), physx::dynamic::ShapeType::Rectangle, 30.f, 10.f, {420.f, 700.f},
+                     false, physx::dynamic::IntegrationType::Verlet});
+    run(recorded, recordedLog, 60);
+    recordedLog.add({recorded.getStepCount(), physx::dynamic::ShapeType::Circle, 7.5f, 0.f, {1.f / 3.f, 600.f}, true,
+                     physx::dynamic::IntegrationType::Euler});
+    run(recorded, recordedLog, 40);
+
+    std::stringstream saved;
+    recordedLog.save(saved);
+    physx::core::InputLog replayLog;
+    replayLog.load(saved);
+    ASSERT_EQ(42u, replayLog.getSeed());
+    ASSERT_EQ(1.f / 120.f, replayLog.getStepSize());
+    ASSERT_EQ(3u, replayLog.getCommands().size());
+
+    physx::core::Simulation replayed;
+    replayed.setThreadCount(3);
+    addScene(replayed);
+    run(replayed, replayLog, 120);
+
+    const auto& a{recorded.getBodies()};
+    const auto& b{replayed.getBodies()};
+    ASSERT_EQ(a.size(), b.size());
+    ASSERT_EQ(0, std::memcmp(a.getPositionX(), b.getPositionX(), sizeof(float) * a.size()));
+    ASSERT_EQ(0, std::memcmp(a.getPositionY(), b.getPositionY(), sizeof(float) * a.size()));
+    ASSERT_EQ(0, std::memcmp(a.getVelocityX(), b.getVelocityX(), sizeof(float) * a.size()));
+}
@@ -0,0 +1,92 @@
+/**
+ * @file Integrators_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../../include/physx/dynamic/Integrators.hpp"
+#include "../../include/physx/utilities/Lanes.hpp"
+#include "../../include/physx/utilities/Vec2Batch.hpp"
+
+namespace {
+    using physx::dynamic::IntegrationType;
+} // namespace
+
+/**
+ * @brief @c Integrators test 1.
+ */
+TEST(Integrators, GIVEN_constantAcceleration_WHEN_integratedFromRest_THEN_matchesClosedForm) {
+    const float dt{0.01f};
+    const float acceleration{1000.f};
+    const int steps{50};
+
+    float rk4{0.f}, rk4Old{0.f}, rk4Velocity{0.f};
+    float euler{0.f}, eulerOld{0.f}, eulerVelocity{0.f};
+    for (int i{0}; i < steps; ++i) {
+        physx::dynamic::RK4Integrator::step<physx::utils::ScalarLanes>(rk4, rk4Old, rk4Velocity, acceleration, dt);
+        physx::dynamic::EulerIntegrator::step<physx::utils::ScalarLanes>(euler, eulerOld, eulerVelocity,
+                                                                        acceleration, dt);
+    }
+
+    const float time{dt * steps};
+    ASSERT_NEAR(0.5f * acceleration * time * time, rk4, 1e-2f);
+    ASSERT_NEAR(acceleration * dt * dt * steps * (steps + 1) / 2.f, euler, 1e-2f);
+    ASSERT_NEAR(acceleration * time * dt, rk4Velocity, 1e-3f);
+    ASSERT_NEAR(rk4Velocity, eulerVelocity, 1e-3f);
+}
+
+/**
+ * @brief @c Integrators test 2.
+ */
+TEST(Integrators, GIVEN_mixedIntegrationGroups_WHEN_eachGroupBatchIntegrated_THEN_bodiesMatchTheirScalarPolicy) {
+    constexpr std::size_t count{21};
+    const float dt{1.f / 60.f};
+
+    std::vector<float> x(count), y(count), oldX(count), oldY(count), velX(count), velY(count);
+    std::vector<float> accX(count, 30.f), accY(count, 1000.f);
+    std::vector<std::uint8_t> groups(count);
+    for (std::size_t i{0}; i < count; ++i) {
+        x[i] = static_cast<float>(i);
+        oldX[i] = x[i] - 0.25f;
+        velX[i] = 0.25f;
+        groups[i] = physx::dynamic::integrationGroup(static_cast<IntegrationType>(i % 3));
+    }
+    auto expectedX{x}, expectedOldX{oldX}, expectedVelX{velX};
+
+    physx::utils::batch::integrate<physx::dynamic::EulerIntegrator>(x.data(), y.data(), oldX.data(), oldY.data(),
+                                                                    velX.data(), velY.data(), accX.data(),
+                                                                    accY.data(), groups.data(), count, dt);
+    physx::utils::batch::integrate<physx::dynamic::VerletIntegrator>(x.data(), y.data(), oldX.data(), oldY.data(),
+                                                                     velX.data(), velY.data(), accX.data(),
+                                                                     accY.data(), groups.data(), count, dt);
+    physx::utils::batch::integrate<physx::dynamic::RK4Integrator>(x.data(), y.data(), oldX.data(), oldY.data(),
+                                                                  velX.data(), velY.data(), accX.data(),
+                                                                  accY.data(), groups.data(), count, dt);
+
+    for (std::size_t i{0}; i < count; ++i) {
+        switch (static_cast<IntegrationType>(i % 3)) {
+            case IntegrationType::Euler:
+                physx::dynamic::EulerIntegrator::step<physx::utils::ScalarLanes>(expectedX[i], expectedOldX[i],
+                                                                                expectedVelX[i], 30.f, dt);
+                break;
+            case IntegrationType::Verlet:
+                physx::dynamic::VerletIntegrator::step<physx::utils::ScalarLanes>(expectedX[i], expectedOldX[i],
+                                                                                 expectedVelX[i], 30.f, dt);
+                break;
+            case IntegrationType::RK4:
+                physx::dynamic::RK4Integrator::step<physx::utils::ScalarLanes>(expectedX[i], expectedOldX[i],
+                                                                              expectedVelX[i], 30.f, dt);
+                break;
+        }
+
+        ASSERT_EQ(expectedX[i], x[i]);
+        ASSERT_EQ(expectedOldX[i], oldX[i]);
+        ASSERT_EQ(expectedVelX[i], velX[i]);
+        ASSERT_EQ(0.f, accX[i]);
+    }
+}
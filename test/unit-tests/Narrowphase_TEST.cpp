@@ -0,0 +1,51 @@
+/**
+ * @file Narrowphase_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../../include/physx/collision/Narrowphase.hpp"
+
+/**
+ * @brief @c Narrowphase test 1.
+ */
+TEST(Narrowphase, GIVEN_circleAboveAndInsideBox_WHEN_collided_THEN_normalPointsFromCircleToBox) {
+    physx::collision::Contact contact{};
+
+    ASSERT_FALSE(physx::collision::collideCircleBox(0.f, -20.f, 5.f, 0.f, 0.f, 10.f, 10.f, contact));
+
+    ASSERT_TRUE(physx::collision::collideCircleBox(2.f, -13.f, 5.f, 0.f, 0.f, 10.f, 10.f, contact));
+    ASSERT_FLOAT_EQ(0.f, contact.normalX);
+    ASSERT_FLOAT_EQ(1.f, contact.normalY);
+    ASSERT_FLOAT_EQ(2.f, contact.depth);
+    ASSERT_EQ(1u, contact.pointCount);
+    ASSERT_FLOAT_EQ(2.f, contact.pointX[0]);
+    ASSERT_FLOAT_EQ(-10.f, contact.pointY[0]);
+
+    ASSERT_TRUE(physx::collision::collideCircleBox(8.f, 1.f, 5.f, 0.f, 0.f, 10.f, 10.f, contact));
+    ASSERT_FLOAT_EQ(-1.f, contact.normalX);
+    ASSERT_FLOAT_EQ(0.f, contact.normalY);
+    ASSERT_FLOAT_EQ(7.f, contact.depth);
+}
+
+/**
+ * @brief @c Narrowphase test 2.
+ */
+TEST(Narrowphase, GIVEN_stackedBoxes_WHEN_collided_THEN_leastOverlapAxisAndFacePointsAreUsed) {
+    physx::collision::Contact contact{};
+
+    ASSERT_FALSE(physx::collision::collideBoxes(0.f, 0.f, 10.f, 5.f, 25.f, 0.f, 10.f, 5.f, contact));
+
+    ASSERT_TRUE(physx::collision::collideBoxes(0.f, 0.f, 10.f, 5.f, 4.f, 9.f, 10.f, 5.f, contact));
+    ASSERT_FLOAT_EQ(0.f, contact.normalX);
+    ASSERT_FLOAT_EQ(1.f, contact.normalY);
+    ASSERT_FLOAT_EQ(1.f, contact.depth);
+    ASSERT_EQ(2u, contact.pointCount);
+    ASSERT_FLOAT_EQ(-6.f, contact.pointX[0]);
+    ASSERT_FLOAT_EQ(10.f, contact.pointX[1]);
+    ASSERT_FLOAT_EQ(4.f, contact.pointY[0]);
+    ASSERT_FLOAT_EQ(4.f, contact.pointY[1]);
+}
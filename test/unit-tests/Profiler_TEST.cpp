@@ -0,0 +1,36 @@
+/**
+ * @file Profiler_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../../include/physx/utilities/Profiler.hpp"
+
+/**
+ * @brief @c Profiler test 1.
+ */
+TEST(Profiler, GIVEN_moreStepsThanWindow_WHEN_queried_THEN_onlyRecentStepsAreAggregated) {
+    physx::utils::Profiler profiler{4};
+    profiler.setThreadCount(2);
+
+    for (std::uint64_t step{1}; step <= 10; ++step) {
+        profiler.addTime(physx::utils::ProfilePhase::Narrowphase, std::chrono::milliseconds{step});
+        profiler.add(physx::utils::ProfileCounter::Contacts, step);
+        profiler.addFromThread(physx::utils::ProfileCounter::Contacts, 100);
+        profiler.endStep();
+    }
+
+    ASSERT_EQ(4u, profiler.getSampleCount());
+
+    const physx::utils::ProfileStats time{profiler.getPhase(physx::utils::ProfilePhase::Narrowphase)};
+    ASSERT_DOUBLE_EQ(8.5, time.mean);
+    ASSERT_DOUBLE_EQ(10.0, time.max);
+    ASSERT_DOUBLE_EQ(10.0, time.last);
+
+    const physx::utils::ProfileStats contacts{profiler.getCounter(physx::utils::ProfileCounter::Contacts)};
+    ASSERT_DOUBLE_EQ(108.5, contacts.mean);
+    ASSERT_DOUBLE_EQ(0.0, profiler.getCounter(physx::utils::ProfileCounter::PairsTested).max);
+}
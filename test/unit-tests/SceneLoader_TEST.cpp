@@ -0,0 +1,46 @@
+/**
+ * @file SceneLoader_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "../../include/physx/core/SceneLoader.hpp"
+
+/**
+ * @brief @c SceneLoader test 1.
+ */
+TEST(SceneLoader, GIVEN_sleepThreshold_WHEN_loaded_THEN_badSpeedIsRejected) {
+    for (const char* scene : {"sleep abc 30\n", "sleep 3x 30\n", "sleep 0 30\n", "sleep 3\n"}) {
+        physx::core::Simulation simulation;
+        std::istringstream input{scene};
+        ASSERT_THROW(physx::core::SceneLoader::load(input, simulation), physx::except::SceneLoadException);
+    }
+
+    physx::core::Simulation simulation;
+    std::istringstream input{"sleep off\nsleep 2.5 10\n"};
+    physx::core::SceneLoader::load(input, simulation);
+    ASSERT_TRUE(simulation.isSleepEnabled());
+}
+
+/**
+ * @brief @c SceneLoader test 2.
+ */
+TEST(SceneLoader, GIVEN_boundary_WHEN_loaded_THEN_badRadiusIsRejected) {
+    for (const char* scene : {"boundary abc 500 500\n", "boundary 400x 500 500\n", "boundary -400 500 500\n",
+                              "boundary 400 500\n"}) {
+        physx::core::Simulation simulation;
+        std::istringstream input{scene};
+        ASSERT_THROW(physx::core::SceneLoader::load(input, simulation), physx::except::SceneLoadException);
+    }
+
+    physx::core::Simulation simulation;
+    std::istringstream input{"boundary 400 300 200\n"};
+    physx::core::SceneLoader::load(input, simulation);
+    ASSERT_EQ(400.f, simulation.getConstraintRadius());
+    ASSERT_EQ(300.f, simulation.getConstraintCenter().getX());
+}
@@ -0,0 +1,196 @@
+/**
+ * @file Simulation_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <algorithm>
+#include <filesystem>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "../../include/physx/core/SceneLoader.hpp"
+#include "../../include/physx/core/Simulation.hpp"
+
+namespace {
+    void addStack(physx::core::Simulation& simulation) {
+        simulation.addRectangleObject(400.f, 20.f, {500.f, 700.f}, false);
+        for (int i{0}; i < 4; ++i) {
+            simulation.addRectangleObject(40.f, 20.f, {500.f, 670.f - static_cast<float>(i) * 22.f}, true);
+        }
+    }
+} // namespace
+
+/**
+ * @brief @c Simulation test 1.
+ */
+TEST(Simulation, GIVEN_stackOnStaticFloor_WHEN_solvedEitherWay_THEN_boxesRestOnEachOther) {
+    for (const auto type : {physx::collision::SolverType::GaussSeidel, physx::collision::SolverType::Jacobi}) {
+        physx::core::Simulation simulation;
+        simulation.setSolver(type, 8);
+        addStack(simulation);
+
+        for (int step{0}; step < 180; ++step) {
+            simulation.update(1.f / 60.f);
+        }
+
+        const physx::math::f32* y{simulation.getBodies().getPositionY()};
+        for (std::size_t i{1}; i < 5; ++i) {
+            ASSERT_NEAR(y[i - 1] - 20.f, y[i], 1.f);
+        }
+    }
+}
+
+/**
+ * @brief @c Simulation test 2.
+ */
+TEST(Simulation, GIVEN_jacobiSolver_WHEN_threadCountChanges_THEN_resultIsIdentical) {
+    physx::core::Simulation single;
+    physx::core::Simulation parallel;
+    parallel.setThreadCount(3);
+    for (auto* simulation : {&single, &parallel}) {
+        simulation->setSolver(physx::collision::SolverType::Jacobi, 4);
+        addStack(*simulation);
+        for (int i{0}; i < 40; ++i) {
+            simulation->addCircleObject(5.f, {420.f + static_cast<float>(i % 10) * 15.f,
+                                              500.f - static_cast<float>(i / 10) * 15.f}, true);
+        }
+        for (int step{0}; step < 120; ++step) {
+            simulation->update(1.f / 60.f);
+        }
+    }
+
+    for (std::size_t i{0}; i < single.getBodies().size(); ++i) {
+        ASSERT_EQ(single.getBodies().getPositionX()[i], parallel.getBodies().getPositionX()[i]);
+        ASSERT_EQ(single.getBodies().getPositionY()[i], parallel.getBodies().getPositionY()[i]);
+    }
+}
+
+/**
+ * @brief @c Simulation test 3.
+ */
+TEST(Simulation, GIVEN_gaussSeidelPile_WHEN_threadCountChanges_THEN_resultIsIdentical) {
+    physx::core::Simulation single;
+    physx::core::Simulation parallel;
+    parallel.setThreadCount(4);
+    for (auto* simulation : {&single, &parallel}) {
+        simulation->setSolver(physx::collision::SolverType::GaussSeidel, 8);
+        for (int i{0}; i < 300; ++i) {
+            simulation->addCircleObject(6.f, {380.f + static_cast<float>(i % 20) * 13.f,
+                                              600.f - static_cast<float>(i / 20) * 13.f}, true);
+        }
+        for (int step{0}; step < 120; ++step) {
+            simulation->update(1.f / 60.f);
+        }
+    }
+
+    for (std::size_t i{0}; i < single.getBodies().size(); ++i) {
+        ASSERT_EQ(single.getBodies().getPositionX()[i], parallel.getBodies().getPositionX()[i]);
+        ASSERT_EQ(single.getBodies().getPositionY()[i], parallel.getBodies().getPositionY()[i]);
+    }
+}
+
+/**
+ * @brief @c Simulation test 4.
+ */
+TEST(Simulation, GIVEN_storedVelocityBodiesOnBoundary_WHEN_resting_THEN_velocityStaysNearZero) {
+    for (const auto type : {physx::dynamic::IntegrationType::Euler, physx::dynamic::IntegrationType::RK4}) {
+        for (const bool circle : {true, false}) {
+            physx::core::Simulation simulation;
+            if (circle) {
+                simulation.addCircleObject(10.f, {500.f, 930.f}, true, type);
+            } else {
+                simulation.addRectangleObject(20.f, 10.f, {500.f, 930.f}, true, type);
+            }
+
+            for (int step{0}; step < 600; ++step) {
+                simulation.update(1.f / 60.f);
+            }
+
+            ASSERT_NEAR(0.f, simulation.getBodies().getVelocity(0).getX(), 0.1f);
+            ASSERT_NEAR(0.f, simulation.getBodies().getVelocity(0).getY(), 0.1f);
+            ASSERT_LT(simulation.getBodies().getPositionY()[0], 950.f);
+        }
+    }
+}
+
+/**
+ * @brief @c Simulation test 5.
+ */
+TEST(Simulation, GIVEN_deepPileInContainer_WHEN_solvedWithManyIterations_THEN_noBodyLeavesIt) {
+    const std::pair<physx::collision::SolverType, std::size_t> solvers[]{
+        {physx::collision::SolverType::GaussSeidel, 16}, {physx::collision::SolverType::GaussSeidel, 32},
+        {physx::collision::SolverType::Jacobi, 16}};
+    for (const auto& [type, iterations] : solvers) {
+        physx::core::Simulation simulation;
+        simulation.setBoundary({}, 0.f);
+        simulation.setSolver(type, iterations);
+        simulation.addRectangleObject(340.f, 20.f, {500.f, 900.f}, false);
+        simulation.addRectangleObject(20.f, 800.f, {340.f, 500.f}, false);
+        simulation.addRectangleObject(20.f, 800.f, {660.f, 500.f}, false);
+        for (int i{0}; i < 400; ++i) {
+            simulation.addCircleObject(6.f, {358.f + static_cast<float>(i % 20) * 14.f,
+                                             880.f - static_cast<float>(i / 20) * 14.f}, true);
+        }
+
+        for (int step{0}; step < 900; ++step) {
+            simulation.update(1.f / 60.f);
+        }
+
+        const physx::math::f32* x{simulation.getBodies().getPositionX()};
+        const physx::math::f32* y{simulation.getBodies().getPositionY()};
+        for (std::size_t i{3}; i < simulation.getBodies().size(); ++i) {
+            ASSERT_GT(x[i], 350.f);
+            ASSERT_LT(x[i], 650.f);
+            ASSERT_LT(y[i], 890.f);
+        }
+    }
+}
+
+/**
+ * @brief @c Simulation test 6.
+ */
+TEST(Simulation, GIVEN_pileInBoundary_WHEN_settledAndThenHit_THEN_sleepsAndWakes) {
+    physx::core::Simulation simulation;
+    std::istringstream scene{"fill 400 6\n"};
+    physx::core::SceneLoader::load(scene, simulation);
+
+    for (int step{0}; step < 600; ++step) {
+        simulation.update(1.f / 60.f);
+    }
+    ASSERT_EQ(400, simulation.getBodies().getSleepingCount());
+
+    const physx::math::f32* y{simulation.getBodies().getPositionY()};
+    const physx::math::f32 top{*std::min_element(y, y + simulation.getBodies().size())};
+    simulation.addCircleObject(6.f, {500.f, top - 40.f}, true);
+
+    bool woken{false};
+    for (int step{0}; step < 120 && !woken; ++step) {
+        simulation.update(1.f / 60.f);
+        woken = simulation.getBodies().getSleepingCount() < 400;
+    }
+    ASSERT_TRUE(woken);
+}
+
+/**
+ * @brief @c Simulation test 7.
+ */
+TEST(Simulation, GIVEN_joints_WHEN_snapshotLoaded_THEN_jointsAreDropped) {
+    const std::string path{(std::filesystem::temp_directory_path() / "physx_Simulation_TEST.snap").string()};
+    physx::core::Simulation simulation;
+    simulation.addCircleObject(10.f, {480.f, 300.f}, true);
+    simulation.addCircleObject(10.f, {520.f, 300.f}, true);
+    simulation.saveSnapshot(path);
+
+    simulation.addDistanceJoint(simulation.getObjects()[0], simulation.getObjects()[1]);
+    ASSERT_EQ(1u, simulation.getJoints().size());
+
+    simulation.loadSnapshot(path);
+    ASSERT_EQ(2u, simulation.getBodies().size());
+    ASSERT_EQ(0u, simulation.getJoints().size());
+    simulation.update(1.f / 60.f);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,79 @@
+/**
+ * @file StaticWorld_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../../include/physx/collision/StaticWorld.hpp"
+#include "../../include/physx/core/Simulation.hpp"
+
+/**
+ * @brief @c StaticWorld test 1.
+ */
+TEST(StaticWorld, GIVEN_manyShapes_WHEN_queried_THEN_exactlyTheOverlappingShapesAreVisited) {
+    physx::collision::StaticWorld world;
+    for (int i{0}; i < 300; ++i) {
+        const auto x{static_cast<float>((i * 37) % 1000)};
+        const auto y{static_cast<float>((i * 91) % 1000)};
+        switch (i % 3) {
+            case 0:
+                world.addSegment({x, y}, {x + 20.f, y + 5.f});
+                break;
+            case 1:
+                world.addBox({x, y}, 10.f, 30.f);
+                break;
+            default:
+                world.addCircle({x, y}, 8.f);
+                break;
+        }
+    }
+    ASSERT_FALSE(world.isBuilt());
+    world.build();
+    ASSERT_TRUE(world.isBuilt());
+
+    const physx::collision::AABB box{400.f, 300.f, 600.f, 450.f};
+    std::size_t visited{0};
+    world.query(box, [&visited, &box](const physx::collision::StaticShape& shape) {
+        ASSERT_TRUE(shape.getBounds().overlaps(box));
+        ++visited;
+    });
+
+    std::size_t expected{0};
+    for (const auto& shape : world.getShapes()) {
+        expected += shape.getBounds().overlaps(box) ? 1 : 0;
+    }
+    ASSERT_GT(expected, 0u);
+    ASSERT_EQ(expected, visited);
+}
+
+/**
+ * @brief @c StaticWorld test 2.
+ */
+TEST(StaticWorld, GIVEN_bodiesOverPolylineFloor_WHEN_theyFall_THEN_theyRestOnIt) {
+    for (const auto type : {physx::dynamic::IntegrationType::Verlet, physx::dynamic::IntegrationType::Euler,
+                            physx::dynamic::IntegrationType::RK4}) {
+        physx::core::Simulation simulation;
+        simulation.setBoundary({}, 0.f);
+        simulation.getColliders().addPolyline({{100.f, 400.f}, {300.f, 500.f}, {700.f, 500.f}, {900.f, 400.f}},
+                                              false);
+        simulation.getColliders().addBox({500.f, 300.f}, 40.f, 40.f);
+        simulation.addCircleObject(10.f, {400.f, 200.f}, true, type);
+        simulation.addRectangleObject(20.f, 20.f, {600.f, 200.f}, true, type);
+        simulation.addCircleObject(10.f, {500.f, 100.f}, true, type);
+
+        for (int step{0}; step < 240; ++step) {
+            simulation.update(1.f / 60.f);
+        }
+
+        const physx::math::f32* y{simulation.getBodies().getPositionY()};
+        ASSERT_NEAR(490.f, y[0], 1.f);
+        ASSERT_NEAR(490.f, y[1], 1.f);
+        ASSERT_NEAR(270.f, y[2], 1.f);
+        for (std::size_t i{0}; i < 3; ++i) {
+            ASSERT_NEAR(0.f, simulation.getBodies().getVelocity(i).getY(), 0.5f);
+        }
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file SweepAndPrune_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+#include "../../include/physx/collision/SweepAndPrune.hpp"
+
+namespace {
+    using PairSet = std::vector<std::pair<std::uint32_t, std::uint32_t>>;
+
+    std::vector<physx::collision::AABB> randomBoxes(std::size_t count) {
+        std::mt19937 mt{11};
+        std::uniform_real_distribution<float> position{0.f, 1000.f};
+        std::uniform_real_distribution<float> size{1.f, 12.f};
+
+        std::vector<physx::collision::AABB> boxes(count);
+        for (auto& box : boxes) {
+            const float x{position(mt)};
+            const float y{position(mt)};
+            box = {x, y, x + size(mt), y + size(mt)};
+        }
+        return boxes;
+    }
+
+    PairSet bruteForce(const std::vector<physx::collision::AABB>& boxes) {
+        PairSet result;
+        for (std::uint32_t i{0}; i < boxes.size(); ++i) {
+            for (std::uint32_t k{i + 1}; k < boxes.size(); ++k) {
+                if (!boxes[i].isEmpty() && !boxes[k].isEmpty() && boxes[i].overlaps(boxes[k])) {
+                    result.emplace_back(i, k);
+                }
+            }
+        }
+        return result;
+    }
+
+    PairSet sorted(const std::vector<physx::collision::CollisionPair>& pairs) {
+        PairSet result;
+        for (const auto& pair : pairs) {
+            result.emplace_back(pair.a, pair.b);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+} // namespace
+
+/**
+ * @brief @c SweepAndPrune test 1.
+ */
+TEST(SweepAndPrune, GIVEN_randomBoxes_WHEN_pairsFound_THEN_exactlyTheOverlapsAreReported) {
+    const auto boxes{randomBoxes(2000)};
+
+    physx::collision::SweepAndPrune sweepAndPrune;
+    sweepAndPrune.update(boxes.data(), boxes.size());
+
+    std::vector<physx::collision::CollisionPair> pairs;
+    sweepAndPrune.findPairs(boxes.data(), pairs);
+
+    ASSERT_EQ(bruteForce(boxes), sorted(pairs));
+}
+
+/**
+ * @brief @c SweepAndPrune test 2.
+ */
+TEST(SweepAndPrune, GIVEN_smallMovesAndRemovals_WHEN_updated_THEN_resortsIncrementallyAndStaysExact) {
+    auto boxes{randomBoxes(2000)};
+
+    physx::collision::SweepAndPrune sweepAndPrune;
+    sweepAndPrune.update(boxes.data(), boxes.size());
+
+    std::mt19937 mt{3};
+    std::uniform_real_distribution<float> jitter{-0.5f, 0.5f};
+    for (auto& box : boxes) {
+        const float dx{jitter(mt)};
+        box = {box.minX + dx, box.minY, box.maxX + dx, box.maxY};
+    }
+    boxes[10] = physx::collision::AABB::empty();
+    boxes.push_back({500.f, 500.f, 520.f, 520.f});
+
+    sweepAndPrune.update(boxes.data(), boxes.size());
+    ASSERT_GT(sweepAndPrune.getSwapCount(), 0u);
+    ASSERT_LT(sweepAndPrune.getSwapCount(), boxes.size() * 8);
+
+    std::vector<physx::collision::CollisionPair> pairs;
+    sweepAndPrune.findPairs(boxes.data(), pairs);
+
+    ASSERT_EQ(bruteForce(boxes), sorted(pairs));
+}
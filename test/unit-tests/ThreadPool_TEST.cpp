@@ -0,0 +1,42 @@
+/**
+ * @file ThreadPool_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include "../../include/physx/utilities/ThreadPool.hpp"
+
+/**
+ * @brief @c ThreadPool test 1.
+ */
+TEST(ThreadPool, GIVEN_anyThreadCount_WHEN_parallelFor_THEN_everyIndexRunsExactlyOnce) {
+    for (const std::size_t threadCount : {1u, 2u, 4u, 7u}) {
+        physx::utils::ThreadPool pool{threadCount};
+        ASSERT_EQ(threadCount, pool.getThreadCount());
+
+        for (const std::size_t count : {0u, 1u, 3u, 64u, 1000u, 4097u}) {
+            std::vector<std::atomic<int>> visits(count);
+            std::atomic<bool> badIndex{false};
+            pool.parallelFor(count, [&](std::size_t begin, std::size_t end) {
+                if (begin >= end || end > count || physx::utils::ThreadPool::getThreadIndex() >= threadCount) {
+                    badIndex = true;
+                    return;
+                }
+                for (std::size_t i{begin}; i < end; ++i) {
+                    ++visits[i];
+                }
+            });
+
+            ASSERT_FALSE(badIndex);
+            for (std::size_t i{0}; i < count; ++i) {
+                ASSERT_EQ(1, visits[i].load());
+            }
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/**
+ * @file Tracer_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "../../include/physx/core/Simulation.hpp"
+#include "../../include/physx/utilities/ThreadPool.hpp"
+#include "../../include/physx/utilities/Tracer.hpp"
+
+/**
+ * @brief @c Tracer test 1.
+ */
+TEST(Tracer, GIVEN_moreRecordsThanCapacity_WHEN_collected_THEN_onlyTheNewestAreKept) {
+    physx::utils::Tracer tracer{4};
+
+    for (std::uint64_t step{0}; step < 6; ++step) {
+        tracer.setStep(step);
+        tracer.collision(step, step + 1);
+    }
+
+    const std::vector<physx::utils::TraceRecord> records{tracer.collect()};
+    ASSERT_EQ(4u, records.size());
+    ASSERT_EQ(2u, records.front().step);
+    ASSERT_EQ(5u, records.back().a);
+    ASSERT_EQ(6u, records.back().b);
+
+    std::ostringstream out;
+    tracer.setEnabled(false);
+    tracer.remove(9);
+    tracer.dump(out);
+    ASSERT_EQ(0u, out.str().find("2 0 collision 2 3\n"));
+    ASSERT_EQ(std::string::npos, out.str().find("remove"));
+}
+
+/**
+ * @brief @c Tracer test 2.
+ */
+TEST(Tracer, GIVEN_parallelLoop_WHEN_recording_THEN_eachThreadWritesItsOwnRing) {
+    physx::utils::ThreadPool pool{4};
+    physx::utils::Tracer tracer{1024};
+    tracer.setThreadCount(pool.getThreadCount());
+
+    pool.parallelFor(1000, [&tracer](std::size_t begin, std::size_t end) {
+        for (std::size_t i{begin}; i < end; ++i) {
+            tracer.collision(i, i);
+        }
+    });
+
+    std::vector<bool> seen(1000, false);
+    for (const physx::utils::TraceRecord& record : tracer.collect()) {
+        ASSERT_EQ(physx::utils::TraceEvent::Collision, record.event);
+        ASSERT_LT(record.thread, pool.getThreadCount());
+        seen[record.a] = true;
+    }
+    ASSERT_EQ(std::vector<bool>(1000, true), seen);
+}
+
+#if defined(PHYSX_TRACING)
+/**
+ * @brief @c Tracer test 3.
+ */
+TEST(Tracer, GIVEN_rectangleOutsideBoundary_WHEN_stepped_THEN_itsClampIsRecordedOnce) {
+    physx::core::Simulation simulation;
+    simulation.addRectangleObject(40.f, 20.f, {500.f, 960.f}, true);
+    simulation.update(1.f / 60.f);
+
+    std::size_t clamps{0};
+    for (const physx::utils::TraceRecord& record : simulation.getTracer().collect()) {
+        clamps += record.event == physx::utils::TraceEvent::ConstraintClamp ? 1 : 0;
+    }
+    ASSERT_EQ(1u, clamps);
+}
+#endif
@@ -0,0 +1,62 @@
+/**
+ * @file Trajectory_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <cmath>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "../../include/physx/utilities/TrajectoryReader.hpp"
+#include "../../include/physx/utilities/TrajectoryRecorder.hpp"
+
+namespace {
+    float positionAt(std::size_t frame, std::size_t body) {
+        return 100.f * std::sin(0.01f * static_cast<float>(frame) + static_cast<float>(body)) - 0.5f * body;
+    }
+} // namespace
+
+/**
+ * @brief @c Trajectory test 1.
+ */
+TEST(Trajectory, GIVEN_recordedSteps_WHEN_seekingToFrame_THEN_positionsMatchWithinQuantum) {
+    const std::string path{(std::filesystem::temp_directory_path() / "physx_Trajectory_TEST.trj").string()};
+    const float quantum{1.f / 64.f};
+    {
+        physx::utils::TrajectoryRecorder recorder{path, quantum, 16, 512};
+        std::vector<float> x, y;
+        for (std::size_t frame{0}; frame < 200; ++frame) {
+            // The body count changes part way through, as it does when bodies are spawned.
+            x.resize(frame < 50 ? 40 : 60);
+            y.resize(x.size());
+            for (std::size_t body{0}; body < x.size(); ++body) {
+                x[body] = positionAt(frame, body);
+                y[body] = -positionAt(frame, body + 7);
+            }
+            ASSERT_TRUE(recorder.record(x.data(), y.data(), x.size()));
+        }
+        recorder.close();
+    }
+
+    physx::utils::TrajectoryReader reader{path};
+    ASSERT_EQ(200u, reader.getFrameCount());
+    ASSERT_EQ(16u, reader.getKeyframeInterval());
+
+    std::vector<float> x, y;
+    for (const std::size_t frame : {137u, 3u, 48u, 199u}) {
+        reader.seek(frame);
+        ASSERT_TRUE(reader.next(x, y));
+        ASSERT_EQ(frame, reader.getStep());
+        ASSERT_EQ(frame < 50 ? 40u : 60u, x.size());
+        for (std::size_t body{0}; body < x.size(); ++body) {
+            ASSERT_NEAR(positionAt(frame, body), x[body], quantum);
+            ASSERT_NEAR(-positionAt(frame, body + 7), y[body], quantum);
+        }
+    }
+    ASSERT_FALSE(reader.next(x, y));
+
+    std::filesystem::remove(path);
+}
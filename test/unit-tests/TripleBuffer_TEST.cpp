@@ -0,0 +1,58 @@
+/**
+ * @file TripleBuffer_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "../../include/physx/utilities/TripleBuffer.hpp"
+
+/**
+ * @brief @c TripleBuffer test 1.
+ */
+TEST(TripleBuffer, GIVEN_severalPublishes_WHEN_read_THEN_onlyTheNewestIsSeen) {
+    physx::utils::TripleBuffer<int> buffer;
+    ASSERT_FALSE(buffer.isPending());
+
+    for (int value{1}; value <= 3; ++value) {
+        buffer.getWriteBuffer() = value;
+        buffer.publish();
+    }
+
+    ASSERT_TRUE(buffer.isPending());
+    ASSERT_EQ(3, buffer.read());
+    ASSERT_FALSE(buffer.isPending());
+    ASSERT_EQ(3, buffer.read());
+}
+
+/**
+ * @brief @c TripleBuffer test 2.
+ */
+TEST(TripleBuffer, GIVEN_concurrentWriter_WHEN_read_THEN_valuesAreCompleteAndInOrder) {
+    physx::utils::TripleBuffer<std::vector<int>> buffer;
+    constexpr int writes{20000};
+
+    std::thread writer{[&buffer] {
+        for (int value{1}; value <= writes; ++value) {
+            buffer.getWriteBuffer().assign(64, value);
+            buffer.publish();
+        }
+    }};
+
+    int last{0};
+    while (last < writes) {
+        const std::vector<int>& values{buffer.read()};
+        if (values.empty()) {
+            continue;
+        }
+        ASSERT_GE(values.front(), last);
+        ASSERT_EQ(values.front(), values.back());
+        last = values.front();
+    }
+    writer.join();
+}
@@ -0,0 +1,79 @@
+/**
+ * @file UniformGrid_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+#include "../../include/physx/collision/UniformGrid.hpp"
+
+namespace {
+    using PairSet = std::vector<std::pair<std::uint32_t, std::uint32_t>>;
+
+    PairSet normalize(const std::vector<physx::collision::CollisionPair>& pairs) {
+        PairSet result;
+        for (const auto& pair : pairs) {
+            result.emplace_back(std::min(pair.a, pair.b), std::max(pair.a, pair.b));
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+} // namespace
+
+/**
+ * @brief @c UniformGrid test 1.
+ */
+TEST(UniformGrid, GIVEN_randomCircles_WHEN_pairsFound_THEN_everyOverlapIsReportedOnce) {
+    const float radius{6.f};
+    std::mt19937 mt{42};
+    std::uniform_real_distribution<float> dist{50.f, 950.f};
+
+    std::vector<float> x(2000);
+    std::vector<float> y(2000);
+    for (std::size_t i{0}; i < x.size(); ++i) {
+        x[i] = dist(mt);
+        y[i] = dist(mt);
+    }
+
+    physx::collision::UniformGrid grid{{50.f, 50.f}, {950.f, 950.f}};
+    grid.build(x.data(), y.data(), x.size(), 2.f * radius);
+
+    std::vector<physx::collision::CollisionPair> pairs;
+    grid.findPairs(pairs);
+    PairSet candidates{normalize(pairs)};
+
+    ASSERT_TRUE(std::adjacent_find(candidates.begin(), candidates.end()) == candidates.end());
+
+    for (std::uint32_t i{0}; i < x.size(); ++i) {
+        for (std::uint32_t k{i + 1}; k < x.size(); ++k) {
+            float dx{x[k] - x[i]};
+            float dy{y[k] - y[i]};
+            if (dx * dx + dy * dy < (2.f * radius) * (2.f * radius)) {
+                ASSERT_TRUE(std::binary_search(candidates.begin(), candidates.end(), std::make_pair(i, k)));
+            }
+        }
+    }
+}
+
+/**
+ * @brief @c UniformGrid test 2.
+ */
+TEST(UniformGrid, GIVEN_bodiesOutsideRegion_WHEN_pairsFound_THEN_clampedIntoBorderCells) {
+    std::vector<float> x{-100.f, -99.f, 2000.f};
+    std::vector<float> y{-100.f, -99.f, 2000.f};
+
+    physx::collision::UniformGrid grid{{50.f, 50.f}, {950.f, 950.f}};
+    grid.build(x.data(), y.data(), x.size(), 10.f);
+
+    std::vector<physx::collision::CollisionPair> pairs;
+    grid.findPairs(pairs);
+
+    ASSERT_EQ(1u, pairs.size());
+    ASSERT_EQ(PairSet({{0u, 1u}}), normalize(pairs));
+}
@@ -0,0 +1,113 @@
+/**
+ * @file Vec2Batch_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "../../include/physx/utilities/Vec2Batch.hpp"
+
+namespace {
+    constexpr std::size_t bodyCount{19};    ///< Not a multiple of any lane width, so the scalar tail runs too.
+
+    std::vector<physx::math::f32> ramp(physx::math::f32 start, physx::math::f32 step) {
+        std::vector<physx::math::f32> values(bodyCount);
+        for (std::size_t i{0}; i < bodyCount; ++i) {
+            values[i] = start + step * static_cast<physx::math::f32>(i);
+        }
+        return values;
+    }
+} // namespace
+
+/**
+ * @brief @c Vec2Batch test 1.
+ */
+TEST(Vec2Batch, GIVEN_mixedBodies_WHEN_integrated_THEN_onlyEnabledBodiesMatchScalarVerlet) {
+    auto x{ramp(10.f, 3.f)};
+    auto y{ramp(-5.f, 1.5f)};
+    auto oldX{ramp(9.5f, 3.f)};
+    auto oldY{ramp(-5.25f, 1.5f)};
+    auto accX{ramp(0.f, 10.f)};
+    auto accY{ramp(1000.f, -7.f)};
+    std::vector<physx::math::f32> velX(bodyCount, 42.f);
+    std::vector<physx::math::f32> velY(bodyCount, 42.f);
+    std::vector<std::uint8_t> groups(bodyCount);
+    for (std::size_t i{0}; i < bodyCount; ++i) {
+        groups[i] = i % 3 == 0 ? 0 : physx::dynamic::integrationGroup(physx::dynamic::IntegrationType::Verlet);
+    }
+
+    const auto x0{x}, y0{y}, oldX0{oldX}, oldY0{oldY}, accX0{accX}, accY0{accY};
+    const physx::math::f32 dt{1.f / 60.f};
+
+    physx::utils::batch::integrate<physx::dynamic::VerletIntegrator>(x.data(), y.data(), oldX.data(), oldY.data(),
+                                                                     velX.data(), velY.data(), accX.data(),
+                                                                     accY.data(), groups.data(), bodyCount, dt);
+
+    for (std::size_t i{0}; i < bodyCount; ++i) {
+        if (groups[i] == 0) {
+            ASSERT_EQ(x0[i], x[i]);
+            ASSERT_EQ(oldX0[i], oldX[i]);
+            ASSERT_EQ(42.f, velX[i]);
+            ASSERT_EQ(accY0[i], accY[i]);
+            continue;
+        }
+
+        const physx::math::f32 vx{x0[i] - oldX0[i]};
+        const physx::math::f32 vy{y0[i] - oldY0[i]};
+        ASSERT_EQ(x0[i] + vx + accX0[i] * dt * dt, x[i]);
+        ASSERT_EQ(y0[i] + vy + accY0[i] * dt * dt, y[i]);
+        ASSERT_EQ(x0[i], oldX[i]);
+        ASSERT_EQ(y0[i], oldY[i]);
+        ASSERT_EQ(vx, velX[i]);
+        ASSERT_EQ(vy, velY[i]);
+        ASSERT_EQ(0.f, accX[i]);
+        ASSERT_EQ(0.f, accY[i]);
+    }
+}
+
+/**
+ * @brief @c Vec2Batch test 2.
+ */
+TEST(Vec2Batch, GIVEN_bodiesInsideAndOutside_WHEN_constrained_THEN_onlyOutsideBodiesMoveToTheEdge) {
+    auto x{ramp(0.f, 60.f)};
+    std::vector<physx::math::f32> y(bodyCount, 500.f);
+    const auto extent{ramp(5.f, 1.f)};
+    const auto x0{x};
+
+    physx::utils::batch::constrainToCircle(x.data(), y.data(), extent.data(), bodyCount, 500.f, 500.f, 450.f);
+
+    for (std::size_t i{0}; i < bodyCount; ++i) {
+        const physx::math::f32 limit{450.f - extent[i]};
+        if (std::abs(500.f - x0[i]) > limit) {
+            ASSERT_NEAR(limit, std::abs(500.f - x[i]), 1e-3f);
+        }
+        else {
+            ASSERT_EQ(x0[i], x[i]);
+        }
+        ASSERT_EQ(500.f, y[i]);
+    }
+}
+
+/**
+ * @brief @c Vec2Batch test 3.
+ */
+TEST(Vec2Batch, GIVEN_points_WHEN_distanceCalculated_THEN_matchesScalarDistance) {
+    const auto ax{ramp(1.f, 2.f)};
+    const auto ay{ramp(-3.f, 0.5f)};
+    const auto bx{ramp(4.f, -1.f)};
+    const auto by{ramp(2.f, 0.25f)};
+    std::vector<physx::math::f32> out(bodyCount);
+
+    physx::utils::batch::distance(ax.data(), ay.data(), bx.data(), by.data(), out.data(), bodyCount);
+
+    for (std::size_t i{0}; i < bodyCount; ++i) {
+        const physx::math::f32 dx{ax[i] - bx[i]};
+        const physx::math::f32 dy{ay[i] - by[i]};
+        ASSERT_EQ(std::sqrt(dx * dx + dy * dy), out[i]);
+    }
+}
@@ -0,0 +1,27 @@
+/**
+ * @file Vec2Utils_TEST.cpp
+ * @author liam (rossliam2212[at]gmail.com)
+ * @date 17/10/2026
+ * @copyright Copyright (c) 2026 liam under MIT licence.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../../include/physx/utilities/Vec2Utils.hpp"
+
+/**
+ * @brief @c Vec2Utils test 1.
+ */
+TEST(Vec2Utils, GIVEN_twoVectors_WHEN_dotted_THEN_componentProductsAreSummed) {
+    ASSERT_EQ(11.f, physx::utils::dot({1.f, 2.f}, {3.f, 4.f}));
+    ASSERT_EQ(-6.f, physx::utils::dot({0.f, 2.f}, {5.f, -3.f}));
+    ASSERT_EQ(0.f, physx::utils::dot({1.f, 0.f}, {0.f, 1.f}));
+}
+
+/**
+ * @brief @c Vec2Utils test 2.
+ */
+TEST(Vec2Utils, GIVEN_twoVectors_WHEN_crossed_THEN_signedAreaIsReturned) {
+    ASSERT_EQ(-2.f, physx::utils::cross({1.f, 2.f}, {3.f, 4.f}));
+    ASSERT_EQ(1.f, physx::utils::cross({1.f, 0.f}, {0.f, 1.f}));
+}